@@ -0,0 +1,57 @@
+#pragma once
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class Game; // déclaration avant 向前声明
+
+// Sauvegarde automatique en arrière-plan
+// Le thread de jeu ne fait qu'une copie de l'état (Game::autosave) ; l'encodage JSON/binaire
+// et l'écriture ont lieu sur un thread dédié, dans un fichier temporaire renommé ensuite
+// (le fichier de sauvegarde n'est jamais à moitié écrit)
+// Si un instantané arrive avant que le précédent soit écrit, seul le plus récent est conservé
+//  后台自动存档
+//  游戏线程只复制状态(Game::autosave); JSON/二进制编码和写入在专用线程上进行,
+//  先写入临时文件再重命名(存档文件永远不会只写了一半)
+//  如果上一个快照还没写入就来了新的快照, 只保留最新的
+class AutoSaver
+{
+private:
+    std::string filename;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    // Instantané en attente d'écriture (nullptr si aucun)
+    //  等待写入的快照(没有时为 nullptr)
+    std::unique_ptr<Game> pending;
+    bool writing = false;
+    bool stopping = false;
+    // Erreur de la dernière écriture ratée, vide si aucune
+    //  最近一次写入失败的错误, 没有时为空
+    std::string error;
+    std::thread worker;
+
+    void run();
+    void write(Game &snapshot);
+
+public:
+    explicit AutoSaver(std::string filename);
+    // Termine l'écriture en attente, puis arrête le thread
+    //  完成等待中的写入, 然后停止线程
+    ~AutoSaver();
+    AutoSaver(const AutoSaver &) = delete;
+    AutoSaver &operator=(const AutoSaver &) = delete;
+
+    // Confier un instantané au thread d'écriture (remplace celui qui n'a pas encore été écrit)
+    //  将快照交给写入线程(替换尚未写入的快照)
+    void submit(std::unique_ptr<Game> snapshot);
+    // Attendre que tous les instantanés confiés soient écrits
+    //  等待所有已提交的快照写入完成
+    void flush();
+    // Erreur de la dernière écriture ratée (vide si aucune), effacée après lecture
+    //  最近一次写入失败的错误(没有时为空), 读取后清除
+    std::string takeError();
+    const std::string &getFilename() const { return filename; }
+};
@@ -0,0 +1,144 @@
+#pragma once
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Écriture d'une sauvegarde binaire dans un tampon mémoire (petit-boutiste, indépendant de la plateforme)
+//  将二进制存档写入内存缓冲区(小端序, 与平台无关)
+class BinaryWriter
+{
+private:
+    std::string buffer;
+
+public:
+    void u8(std::uint8_t value) { buffer.push_back(static_cast<char>(value)); }
+    void u16(std::uint16_t value)
+    {
+        u8(static_cast<std::uint8_t>(value));
+        u8(static_cast<std::uint8_t>(value >> 8));
+    }
+    void u32(std::uint32_t value)
+    {
+        u16(static_cast<std::uint16_t>(value));
+        u16(static_cast<std::uint16_t>(value >> 16));
+    }
+    void u64(std::uint64_t value)
+    {
+        u32(static_cast<std::uint32_t>(value));
+        u32(static_cast<std::uint32_t>(value >> 32));
+    }
+    void i32(std::int32_t value) { u32(static_cast<std::uint32_t>(value)); }
+    // Entier signé de taille variable (zigzag puis 7 bits par octet) : un octet de -64 à 63
+    //  变长有符号整数(zigzag 编码, 每字节7位): -64 到 63 只占一个字节
+    void var(std::int32_t value)
+    {
+        std::uint32_t bits = (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31);
+        while (bits >= 0x80)
+        {
+            u8(static_cast<std::uint8_t>(bits | 0x80));
+            bits >>= 7;
+        }
+        u8(static_cast<std::uint8_t>(bits));
+    }
+
+    // Chaîne : longueur sur 16 bits puis octets
+    //  字符串: 16位长度, 然后是字节
+    void str(const std::string &value)
+    {
+        u16(static_cast<std::uint16_t>(value.size()));
+        buffer.append(value);
+    }
+
+    // Zone de cartes : nombre sur 16 bits puis un octet par carte
+    //  卡片区域: 16位数量, 然后每张卡一个字节
+    template <typename Allocator>
+    void cards(const std::vector<std::uint8_t, Allocator> &zone)
+    {
+        u16(static_cast<std::uint16_t>(zone.size()));
+        buffer.append(zone.begin(), zone.end());
+    }
+
+    const std::string &data() const { return buffer; }
+};
+
+// Lecture d'une sauvegarde binaire, exception si les données sont tronquées
+//  读取二进制存档, 数据被截断时抛出异常
+class BinaryReader
+{
+private:
+    const std::string &buffer;
+    std::size_t pos;
+
+    void require(std::size_t count) const
+    {
+        if (buffer.size() - pos < count)
+        {
+            throw std::runtime_error("Sauvegarde binaire tronquée"); // 二进制存档被截断
+        }
+    }
+
+public:
+    explicit BinaryReader(const std::string &data) : buffer(data), pos(0) {}
+
+    std::uint8_t u8()
+    {
+        require(1);
+        return static_cast<std::uint8_t>(buffer[pos++]);
+    }
+    std::uint16_t u16()
+    {
+        std::uint16_t low = u8();
+        return static_cast<std::uint16_t>(low | (static_cast<std::uint16_t>(u8()) << 8));
+    }
+    std::uint32_t u32()
+    {
+        std::uint32_t low = u16();
+        return low | (static_cast<std::uint32_t>(u16()) << 16);
+    }
+    std::uint64_t u64()
+    {
+        std::uint64_t low = u32();
+        return low | (static_cast<std::uint64_t>(u32()) << 32);
+    }
+    std::int32_t i32() { return static_cast<std::int32_t>(u32()); }
+    std::int32_t var()
+    {
+        std::uint32_t bits = 0;
+        for (int shift = 0;; shift += 7)
+        {
+            if (shift > 28)
+            {
+                throw std::runtime_error("Entier variable invalide"); // 无效的变长整数
+            }
+            std::uint8_t byte = u8();
+            bits |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+            {
+                break;
+            }
+        }
+        return static_cast<std::int32_t>((bits >> 1) ^ (~(bits & 1) + 1));
+    }
+    // Toutes les données ont été lues
+    //  所有数据都已读取
+    bool atEnd() const { return pos == buffer.size(); }
+
+    std::string str()
+    {
+        std::uint16_t size = u16();
+        require(size);
+        std::string value = buffer.substr(pos, size);
+        pos += size;
+        return value;
+    }
+
+    template <typename Allocator>
+    void cards(std::vector<std::uint8_t, Allocator> &zone)
+    {
+        std::uint16_t size = u16();
+        require(size);
+        zone.assign(buffer.begin() + pos, buffer.begin() + pos + size);
+        pos += size;
+    }
+};
@@ -0,0 +1,93 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include "DecisionProvider.h"
+
+// Base des bots scriptés : choix de Milice, Cave, Chapelle et Voleur communs,
+// actions jouées selon une liste de priorité, gains d'Atelier/Festin via la règle d'achat
+// Aucune allocation hors de la Cave, pour jouer des millions de parties par heure
+//  脚本机器人的基类: 民兵、地窖、教堂和窃贼的选择共用,
+//  按优先级列表使用行动卡, 工场/盛宴的获得沿用购买规则
+//  除地窖外无内存分配, 以便每小时进行数百万局
+class BotStrategy : public DecisionProvider
+{
+public:
+    CardId chooseAction(const Player &player, const Game &game) override;
+    CardId chooseBuy(const Player &player, const Game &game) override;
+    CardId chooseGain(const Player &player, const Game &game, int maxCost) override;
+    int chooseDiscard(const Player &player, const Game &game) override;
+    std::vector<int> chooseCellarDiscards(const Player &player, const Game &game) override;
+    int chooseTrash(const Player &player, const Game &game) override;
+    int chooseThiefTreasure(const Player &player, const Game &game, const Player &victim,
+                            const std::vector<CardId> &treasures) override;
+
+protected:
+    // Carte à prendre avec coins pièces, CardIds::INVALID pour rien
+    //  用 coins 金币要获得的卡, CardIds::INVALID 表示不获得
+    virtual CardId pickCard(const Player &player, const Game &game, int coins) const = 0;
+    // Cartes action dans l'ordre où les jouer (celles qui donnent des actions d'abord)
+    //  行动卡的使用顺序(先用提供行动点的卡)
+    virtual const std::vector<CardId> &actionPriority() const;
+
+    // Fin de partie commune : Province, puis Duché et Manoir quand les Provinces s'épuisent
+    //  共用的终局规则: 行省, 行省将尽时买公爵领地和庄园
+    static CardId pickVictory(const Game &game, int coins);
+    // Or puis Argent
+    //  金币, 然后银币
+    static CardId pickTreasure(const Game &game, int coins);
+    // Nombre d'exemplaires de la carte possédés (pioche, main, défausse, en jeu)
+    //  拥有的该卡数量(牌堆、手牌、弃牌堆、场上)
+    static int countOwned(const Player &player, CardId card);
+};
+
+// Big Money : n'achète que des trésors et des points de victoire, ne joue aucune action
+// Stratégie de référence pour les simulations (Duché/Manoir en fin de partie)
+//  大钱策略: 只购买财宝和胜利点数卡, 不使用行动卡
+//  模拟中的基准策略(游戏后期购买公爵领地/庄园)
+class BigMoneyStrategy : public BotStrategy
+{
+protected:
+    CardId pickCard(const Player &player, const Game &game, int coins) const override;
+    const std::vector<CardId> &actionPriority() const override;
+};
+
+// Smithy Big Money : Big Money avec une Forge pour environ 12 cartes du deck
+//  铁匠大钱: 大钱策略, 每约12张牌配一张铁匠
+class SmithyBigMoneyStrategy : public BotStrategy
+{
+protected:
+    CardId pickCard(const Player &player, const Game &game, int coins) const override;
+};
+
+// Witch rush : deux Sorcières dès que possible, puis Big Money
+//  女巫速攻: 尽早购买两张女巫, 然后大钱策略
+class WitchRushStrategy : public BotStrategy
+{
+protected:
+    CardId pickCard(const Player &player, const Game &game, int coins) const override;
+};
+
+// Moteur : Chapelle pour alléger le deck, Villages/Laboratoires/Marchés et Forges, puis Provinces
+//  引擎: 用教堂精简牌组, 村庄/实验室/市场配铁匠, 然后购买行省
+class EngineStrategy : public BotStrategy
+{
+public:
+    int chooseTrash(const Player &player, const Game &game) override;
+
+protected:
+    CardId pickCard(const Player &player, const Game &game, int coins) const override;
+};
+
+// Fabrique des stratégies de bots par nom
+//  按名称创建机器人策略的工厂
+class BotStrategies
+{
+public:
+    // Créer la stratégie nommée (insensible à la casse), exception si inconnue
+    //  创建指定名称的策略(不区分大小写), 未知时抛出异常
+    static std::shared_ptr<DecisionProvider> create(const std::string &name);
+    // Noms des stratégies disponibles
+    //  可用策略的名称
+    static const std::vector<std::string> &names();
+};
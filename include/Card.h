@@ -1,8 +1,10 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <fstream>
 #include <nlohmann/json.hpp>
+#include "CardDefinitions.h"
 
 // déclaration avant
 //  前向声明
@@ -13,17 +15,10 @@ class Game;
 //  使用 nlohmann::json
 using json = nlohmann::json;
 
-// Énumération : type de carte
-//  枚举: 卡片类型
-enum class CardType
-{
-    TREASURE,
-    VICTORY,
-    ACTION
-};
-
 // Classe de carte
+// Une seule instance immuable (prototype) existe par type de carte
 //  卡片类
+//  每种卡片只存在一个不可变的实例(原型)
 class Card
 {
 protected:
@@ -35,15 +30,20 @@ protected:
     // 名称
     // 花费
     // 类型
+    CardId id;
     std::string name;
     int cost;
     CardType type;
 
+    // Appliquer les bonus fixes de la définition : +cartes, +actions, +achats, +pièces
+    //  结算定义中的固定奖励: +卡片, +行动, +购买, +金币
+    void applyBonuses(Player &player) const;
+
 public:
-    // Constructeur
-    //  构造函数
-    Card(std::string name, int cost, CardType type)
-        : name(name), cost(cost), type(type) {}
+    // Constructeur : nom, coût et type viennent de CARD_DEFINITIONS
+    //  构造函数: 名称、花费和类型来自 CARD_DEFINITIONS
+    explicit Card(CardId id)
+        : id(id), name(CARD_DEFINITIONS[id].name), cost(CARD_DEFINITIONS[id].cost), type(CARD_DEFINITIONS[id].type) {}
 
     // destructeur virtuel
     //  虚析构函数
@@ -51,14 +51,18 @@ public:
 
     // Fonction virtuelle pure -les sous-classes doivent implémenter
     //  纯虚函数 - 子类必须实现
-    virtual void play(Player &player, Game &game) = 0; // Exécuter l'effet de la carte
-                                                       //  执行卡片效果
+    virtual void play(Player &player, Game &game) const = 0; // Exécuter l'effet de la carte
+                                                             //  执行卡片效果
     virtual std::string toString() const { return name; } // Récupère le nom de la carte
     // 获取卡片名称
-    virtual int getVictoryPoints() const { return 0; } // Obtenez des points de victoire de carte
+    int getVictoryPoints() const { return CARD_DEFINITIONS[id].victoryPoints; } // Obtenez des points de victoire de carte
     // 获取卡片胜利点数
-    virtual std::string getDescription() const = 0; // Récupère la description de la carte
-                                                    //  获取卡片描述
+    int getCoinValue() const { return CARD_DEFINITIONS[id].coins; } // Pièces rapportées par un trésor joué
+    // 财宝卡使用时提供的金币
+    std::string getDescription() const { return CARD_DEFINITIONS[id].description; } // Récupère la description de la carte
+                                                                                      //  获取卡片描述
+    virtual std::string describePlay(int amount) const; // Texte du journal quand la carte est jouée
+                                                        //  使用该卡时的日志文本
 
     // Méthode de sérialisation JSON
     //  JSON序列化方法
@@ -73,19 +77,32 @@ public:
 
     // méthode de fabrique statique
     //  静态工厂方法
-    static std::shared_ptr<Card> fromJson(const json &j); // Créer des cartes à partir de JSON
-                                                          //  从JSON中创建卡片
+    static CardId fromJson(const json &j); // Récupère l'identifiant de la carte à partir de JSON
+                                           //  从JSON中获取卡片标识
     static std::shared_ptr<Card> createCard(const std::string &cardName); // Créer une carte basée sur le nom
                                                                           //  根据名称创建卡片
 
+    // Registre des prototypes
+    //  原型注册表
+    static const Card &get(CardId id); // Prototype partagé de la carte
+                                       //  卡片的共享原型
+    static CardId idOf(const std::string &cardName); // Identifiant d'après le nom, exception si inconnu
+                                                     //  根据名称获取标识, 未知时抛出异常
+    static CardId findId(const std::string &cardName); // Identifiant d'après le nom, CardIds::INVALID si inconnu
+                                                       //  根据名称获取标识, 未知时返回 CardIds::INVALID
+
     // getteurs
     //  Getters
-    std::string getName() const { return name; } // Récupère le nom de la carte
+    CardId getId() const { return id; } // Récupère l'identifiant de la carte
+    // 获取卡片标识
+    const std::string &getName() const { return name; } // Récupère le nom de la carte
     // 获取卡片名称
     int getCost() const { return cost; } // Obtenez le coût de la carte
     // 获取卡片花费
     CardType getType() const { return type; } // Récupère le type de carte
     // 获取卡片类型
+    const CardDefinition &getDefinition() const { return CARD_DEFINITIONS[id]; } // Caractéristiques fixes de la carte
+    // 卡片的固定属性
 
     // inutile
     // Ajouter des déclarations pour les méthodes de sérialisation et de désérialisation
@@ -0,0 +1,259 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Énumération : type de carte
+//  枚举: 卡片类型
+enum class CardType
+{
+    TREASURE,
+    VICTORY,
+    ACTION
+};
+
+// Identifiant compact d'une carte : index dans la table des prototypes
+// Les piles, mains, decks et défausses ne stockent que ces identifiants
+//  卡片的紧凑标识: 原型表中的索引
+//  供应堆、手牌、牌组和弃牌堆只保存这些标识
+using CardId = std::uint8_t;
+
+namespace CardIds
+{
+    enum : CardId
+    {
+        // Cartes de base
+        //  基础卡
+        COPPER,
+        SILVER,
+        GOLD,
+        ESTATE,
+        DUCHY,
+        PROVINCE,
+        CURSE,
+        // Cartes du royaume
+        //  王国卡
+        GARDENS,
+        VILLAGE,
+        WOODCUTTER,
+        MILITIA,
+        MARKET,
+        SMITHY,
+        COUNCIL_ROOM,
+        MONEYLENDER,
+        MOAT,
+        WORKSHOP,
+        CELLAR,
+        WITCH,
+        THIEF,
+        CHAPEL,
+        FEAST,
+        LABORATORY,
+        // Nombre de cartes différentes
+        //  卡片种类数量
+        COUNT,
+        // Aucune carte (passer, terminer, introuvable)
+        //  无卡片(跳过, 结束, 找不到)
+        INVALID = 0xFF
+    };
+
+    // Les cartes de base précèdent les cartes du royaume
+    //  基础卡排在王国卡之前
+    constexpr CardId FIRST_KINGDOM = GARDENS;
+}
+
+// Caractéristiques fixes d'une carte
+// Les bonus (cartes, actions, achats, pièces) sont appliqués au début de chaque jeu de la carte
+// Une carte "vanilla" n'a pas d'autre effet : elle n'a pas besoin de classe propre
+//  卡片的固定属性
+//  奖励(卡片、行动、购买、金币)在每次使用该卡时首先结算
+//  "vanilla" 卡没有其他效果: 不需要单独的类
+struct CardDefinition
+{
+    CardId id;
+    const char *factoryName; // Nom d'usine et de sauvegarde ("CouncilRoom")
+                             //  工厂和存档名称("CouncilRoom")
+    const char *name;        // Nom affiché ("Council Room")
+                             //  显示名称("Council Room")
+    int cost;
+    CardType type;
+    int victoryPoints;
+    int cards;
+    int actions;
+    int buys;
+    int coins; // Valeur d'un trésor, ou +pièces d'une action
+               //  财宝卡的面值, 或行动卡的+金币
+    bool vanilla;
+    const char *playText; // Texte du journal quand la carte est jouée (nullptr : "<nom> utilisé")
+                          //  使用该卡时的日志文本(nullptr: "<名称> utilisé")
+    const char *description;
+};
+
+// Table unique des cartes, dans l'ordre des identifiants
+// La fabrique, la recherche par nom, la liste des cartes du royaume et les effets simples en sont générés
+//  唯一的卡片表, 按标识顺序排列
+//  工厂、按名称查找、王国卡列表和简单效果都由它生成
+inline constexpr std::array<CardDefinition, CardIds::COUNT> CARD_DEFINITIONS = {{
+    // id, usine, nom, coût, type, PV, +cartes, +actions, +achats, +pièces, vanilla
+    //  标识, 工厂名, 名称, 花费, 类型, 胜利点, +卡片, +行动, +购买, +金币, vanilla
+    {CardIds::COPPER, "Copper", "Copper", 0, CardType::TREASURE, 0, 0, 0, 0, 1, true, nullptr,
+     "Cuivre (0 pièces)\nEffet : +1 pièce\nDescription : Carte de base pour générer des pièces."},
+    {CardIds::SILVER, "Silver", "Silver", 3, CardType::TREASURE, 0, 0, 0, 0, 2, true, nullptr,
+     "Argent (3 pièces)\nEffet : +2 pièces\nDescription : Carte intermédiaire pour générer des pièces."},
+    {CardIds::GOLD, "Gold", "Gold", 6, CardType::TREASURE, 0, 0, 0, 0, 3, true, nullptr,
+     "Or (6 pièces)\nEffet : +3 pièces\nDescription : Carte avancée pour générer des pièces."},
+    {CardIds::ESTATE, "Estate", "Estate", 2, CardType::VICTORY, 1, 0, 0, 0, 0, true, nullptr,
+     "Domaine (2 pièces)\nEffet : 1 point de victoire\nDescription : Carte de base pour marquer des points de victoire."},
+    {CardIds::DUCHY, "Duchy", "Duchy", 5, CardType::VICTORY, 3, 0, 0, 0, 0, true, nullptr,
+     "Duché (5 pièces)\nEffet : 3 points de victoire\nDescription : Carte intermédiaire pour marquer des points de victoire."},
+    {CardIds::PROVINCE, "Province", "Province", 8, CardType::VICTORY, 6, 0, 0, 0, 0, true, nullptr,
+     "Province (8 pièces)\nEffet : 6 points de victoire\nDescription : Carte avancée pour marquer des points de victoire."},
+    {CardIds::CURSE, "Curse", "Curse", 0, CardType::VICTORY, -1, 0, 0, 0, 0, true, nullptr,
+     "Malédiction (0 pièces)\nEffet : -1 point de victoire\nDescription : Carte à effet négatif."},
+    // Jardins : 0 ici, les points dépendent du nombre de cartes (Game::calculateGardensPoints)
+    //  花园: 此处为0, 分数取决于牌的数量(Game::calculateGardensPoints)
+    {CardIds::GARDENS, "Gardens", "Gardens", 4, CardType::VICTORY, 0, 0, 0, 0, 0, true, nullptr,
+     "Jardin (4 pièces)\nEffet : 1 point de victoire pour chaque 10 cartes que vous possédez\nDescription : Carte de victoire spéciale qui récompense une grande quantité de cartes."},
+    {CardIds::VILLAGE, "Village", "Village", 3, CardType::ACTION, 0, 1, 2, 0, 0, true,
+     "Village utilisé (+1 carte, +2 action)",
+     "Village (3 pièces)\nEffet : carte +1, action +2\nDescription : carte de génération de chaîne d'action de base"},
+    {CardIds::WOODCUTTER, "Woodcutter", "Woodcutter", 3, CardType::ACTION, 0, 0, 0, 1, 2, true,
+     "Bûcheron utilisé(+1 achat, +2 pièces)",
+     "Bûcheron (3 pièces)\nEffet : +1 achat, +2 pièces\nDescription : Offre des achats supplémentaires et des pièces."},
+    {CardIds::MILITIA, "Militia", "Militia", 4, CardType::ACTION, 0, 0, 0, 0, 2, false,
+     "Milice utilisé (+2 pièces, les autres joueurs doivent défausser jusqu'à 3 cartes)",
+     "Milice  (4 pièces)\nEffet : +2 pièces, les autres joueurs doivent défausser jusqu'à 3 cartes\nDescription : Carte d'attaque qui force les autres joueurs à défausser des cartes."},
+    {CardIds::MARKET, "Market", "Market", 5, CardType::ACTION, 0, 1, 1, 1, 1, true,
+     "Marché utilisé (+1 carte, +1 action, +1 achat, +1 pièce)",
+     "Marché (5 pièces)\nEffet : +1 carte, +1 action, +1 achat, +1 pièce\nDescription : Amélioration globale pour toutes les capacités."},
+    {CardIds::SMITHY, "Smithy", "Smithy", 4, CardType::ACTION, 0, 3, 0, 0, 0, true,
+     "Forgeron utilisé (+3 cartes)",
+     "Forgeron (4 pièces)\nEffet : +3 cartes\nDescription : Carte puissante pour piocher davantage de cartes."},
+    {CardIds::COUNCIL_ROOM, "CouncilRoom", "Council Room", 5, CardType::ACTION, 0, 4, 0, 1, 0, false,
+     "Salle du Conseil utilisée (+4 cartes, +1 achat, chaque autre joueur pioche 1 carte)",
+     "Salle du Conseil (5 pièces)\nEffet : +4 cartes, +1 achat, chaque autre joueur pioche 1 carte\nDescription : Carte puissante pour piocher, mais qui permet aussi aux autres joueurs de piocher une carte."},
+    // Prêteur : les +3 pièces dépendent de l'écart d'un Cuivre, elles ne sont pas un bonus fixe
+    //  钱庄: +3金币取决于是否废除了铜币, 不是固定奖励
+    {CardIds::MONEYLENDER, "Moneylender", "Moneylender", 4, CardType::ACTION, 0, 0, 0, 0, 0, false, nullptr,
+     "Trésorerie (4 pièces)\nEffet : Abandonnez un Cuivre pour obtenir +3 pièces\nDescription : Carte permettant de transformer un Cuivre en plus de pièces."},
+    // Douves : la protection contre les attaques est vérifiée par Game lors de l'attaque
+    //  护城河: 对攻击的防御由 Game 在攻击时检查
+    {CardIds::MOAT, "Moat", "Moat", 2, CardType::ACTION, 0, 2, 0, 0, 0, true,
+     "Douve utilisé (+2 cartes)",
+     "Douve  (2 pièces)\nEffet : +2 cartes, peut bloquer les attaques\nDescription : Carte pratique qui permet à la fois de piocher et de se défendre."},
+    {CardIds::WORKSHOP, "Workshop", "Workshop", 3, CardType::ACTION, 0, 0, 0, 0, 0, false,
+     "Atelier utilisé (obtenez une carte coûtant jusqu’à 4 pièces)",
+     "Atelier (3 pièces)\nEffet : Obtenez une carte coûtant jusqu’à 4 pièces\nDescription : Utile pour acquérir des cartes de faible ou moyen coût."},
+    {CardIds::CELLAR, "Cellar", "Cellar", 2, CardType::ACTION, 0, 0, 1, 0, 0, false, nullptr,
+     "Cave (2 pièces)\nEffet : +1 action, vous pouvez défausser n’importe quel nombre de cartes, puis en piocher autant\nDescription : Carte pratique pour optimiser votre main."},
+    {CardIds::WITCH, "Witch", "Witch", 5, CardType::ACTION, 0, 2, 0, 0, 0, false,
+     "Sorcière utilisée (+2 cartes, chaque autre joueur reçoit une carte Malédiction)",
+     "Sorcière (5 pièces)\nEffet : +2 cartes, chaque autre joueur reçoit une carte Malédiction\nDescription : Carte d'attaque puissante qui inflige des points négatifs aux adversaires."},
+    {CardIds::THIEF, "Thief", "Thief", 4, CardType::ACTION, 0, 0, 0, 0, 0, false,
+     "Voleur utilisé (regardez et potentiellement gagnez des cartes Trésor des autres joueurs)",
+     "Voleur (4 pièces)\nEffet : Regardez les 2 premières cartes des pioches des autres joueurs, éliminez leurs cartes Trésor et gagnez-les\nDescription : Carte d'attaque permettant de voler les trésors des adversaires."},
+    {CardIds::CHAPEL, "Chapel", "Chapel", 2, CardType::ACTION, 0, 0, 0, 0, 0, false,
+     "Chapelle utilisée (jusqu’à 4 cartes de la main supprimées)",
+     "Chapelle (2 pièces)\nEffet : Supprimez jusqu’à 4 cartes de votre main\nDescription : Carte pratique pour optimiser le contenu de votre deck."},
+    {CardIds::FEAST, "Feast", "Feast", 4, CardType::ACTION, 0, 0, 0, 0, 0, false,
+     "Festin utilisé (cette carte est supprimée, obtenez une carte coûtant jusqu’à 5 pièces)",
+     "Festin (4 pièces)\nEffet : Supprimez cette carte et obtenez une carte coûtant jusqu’à 5 pièces\nDescription : Bonne option pour améliorer les cartes de votre deck."},
+    {CardIds::LABORATORY, "Laboratory", "Laboratory", 5, CardType::ACTION, 0, 2, 1, 0, 0, true,
+     "Laboratoire utilisé (+2 cartes, +1 action)",
+     "Laboratoire (5 pièces)\nEffet : +2 cartes, +1 action\nDescription : Carte puissante pour piocher et générer des actions supplémentaires."},
+}};
+
+// Vérifier à la compilation que chaque entrée est à l'index de son identifiant
+//  编译时检查每个条目都位于其标识对应的索引处
+constexpr bool cardDefinitionsInIdOrder()
+{
+    for (std::size_t i = 0; i < CARD_DEFINITIONS.size(); i++)
+    {
+        if (CARD_DEFINITIONS[i].id != i)
+            return false;
+    }
+    return true;
+}
+static_assert(cardDefinitionsInIdOrder(), "CARD_DEFINITIONS doit suivre l'ordre de CardIds");
+
+// Nombre de cartes du royaume
+//  王国卡数量
+constexpr std::size_t KINGDOM_CARD_COUNT = CardIds::COUNT - CardIds::FIRST_KINGDOM;
+
+// Noms d'usine des cartes du royaume, dans l'ordre des identifiants
+//  王国卡的工厂名称, 按标识顺序排列
+constexpr std::array<const char *, KINGDOM_CARD_COUNT> kingdomCardNames()
+{
+    std::array<const char *, KINGDOM_CARD_COUNT> names{};
+    for (std::size_t i = 0; i < KINGDOM_CARD_COUNT; i++)
+    {
+        names[i] = CARD_DEFINITIONS[CardIds::FIRST_KINGDOM + i].factoryName;
+    }
+    return names;
+}
+
+// Effet fixe compacté d'une carte (4 octets), lu par le noyau Player::applyEffect
+//  卡片的紧凑固定效果(4字节), 由内核 Player::applyEffect 读取
+struct CardEffect
+{
+    std::int8_t cards;
+    std::int8_t actions;
+    std::int8_t buys;
+    std::int8_t coins;
+};
+static_assert(sizeof(CardEffect) == 4, "CardEffect doit rester compact");
+
+constexpr std::array<CardEffect, CardIds::COUNT> cardEffects()
+{
+    std::array<CardEffect, CardIds::COUNT> effects{};
+    for (std::size_t id = 0; id < CardIds::COUNT; id++)
+    {
+        const CardDefinition &definition = CARD_DEFINITIONS[id];
+        effects[id] = {static_cast<std::int8_t>(definition.cards), static_cast<std::int8_t>(definition.actions),
+                       static_cast<std::int8_t>(definition.buys), static_cast<std::int8_t>(definition.coins)};
+    }
+    return effects;
+}
+
+// Effets fixes de toutes les cartes, indexés par identifiant
+//  所有卡片的固定效果, 按标识索引
+inline constexpr std::array<CardEffect, CardIds::COUNT> CARD_EFFECTS = cardEffects();
+
+// Masque des cartes vanilla : bit id à 1 si la carte n'a pas d'autre effet que CARD_EFFECTS[id]
+//  vanilla 卡的掩码: 如果卡片除 CARD_EFFECTS[id] 外没有其他效果, 则第 id 位为1
+constexpr std::uint32_t vanillaCardMask()
+{
+    std::uint32_t mask = 0;
+    for (std::size_t id = 0; id < CardIds::COUNT; id++)
+    {
+        if (CARD_DEFINITIONS[id].vanilla)
+            mask |= 1u << id;
+    }
+    return mask;
+}
+static_assert(CardIds::COUNT <= 32, "le masque vanilla tient dans 32 bits");
+
+inline constexpr std::uint32_t VANILLA_CARDS = vanillaCardMask();
+
+constexpr bool isVanilla(CardId id)
+{
+    return (VANILLA_CARDS >> id) & 1u;
+}
+
+// Masque des cartes d'un type : bit id à 1 si la carte est de ce type
+//  某类型卡片的掩码: 如果卡片属于该类型, 则第 id 位为1
+constexpr std::uint32_t cardTypeMask(CardType type)
+{
+    std::uint32_t mask = 0;
+    for (std::size_t id = 0; id < CardIds::COUNT; id++)
+    {
+        if (CARD_DEFINITIONS[id].type == type)
+            mask |= 1u << id;
+    }
+    return mask;
+}
+
+// Masques précalculés, indexés par CardType
+//  预先计算的掩码, 按 CardType 索引
+inline constexpr std::array<std::uint32_t, 3> CARD_TYPE_MASKS = {
+    cardTypeMask(CardType::TREASURE), cardTypeMask(CardType::VICTORY), cardTypeMask(CardType::ACTION)};
@@ -0,0 +1,55 @@
+#pragma once
+#include <vector>
+#include <string>
+#include "Card.h"
+
+// déclaration avant
+//  前向声明
+class Player;
+class Game;
+
+// Interface de décision d'un joueur : chaque point de choix du moteur passe par ici
+// La saisie au terminal n'est qu'une implémentation parmi d'autres (bots, tests de charge)
+//  玩家决策接口: 引擎中的每个选择点都通过这里
+//  终端输入只是其中一种实现(机器人, 压力测试)
+class DecisionProvider
+{
+public:
+    // destructeur virtuel
+    //  虚析构函数
+    virtual ~DecisionProvider() = default;
+
+    // Nouvelle partie (Game::reset) : oublier ce qui dépend de la partie précédente, pour qu'une partie
+    // donne le même résultat avec un fournisseur neuf ou réutilisé
+    //  新对局(Game::reset): 忘记依赖上一局的内容, 使一局无论使用新的还是复用的提供者结果都相同
+    virtual void reset() {}
+
+    // Phase d'action : carte action à jouer, CardIds::INVALID pour passer
+    //  行动阶段: 要使用的行动卡, CardIds::INVALID 表示跳过
+    virtual CardId chooseAction(const Player &player, const Game &game) = 0;
+
+    // Phase d'achat : carte à acheter, CardIds::INVALID pour terminer
+    //  购买阶段: 要购买的卡片, CardIds::INVALID 表示结束
+    virtual CardId chooseBuy(const Player &player, const Game &game) = 0;
+
+    // Atelier / Festin : carte à obtenir (coût <= maxCost)
+    //  工场 / 盛宴: 要获得的卡片(花费 <= maxCost)
+    virtual CardId chooseGain(const Player &player, const Game &game, int maxCost) = 0;
+
+    // Milice : index de la carte de la main à défausser
+    //  民兵: 要弃掉的手牌索引
+    virtual int chooseDiscard(const Player &player, const Game &game) = 0;
+
+    // Cave : index des cartes de la main à défausser
+    //  地窖: 要弃掉的手牌索引列表
+    virtual std::vector<int> chooseCellarDiscards(const Player &player, const Game &game) = 0;
+
+    // Chapelle : index de la carte de la main à écarter, -1 pour terminer
+    //  教堂: 要废除的手牌索引, -1 表示结束
+    virtual int chooseTrash(const Player &player, const Game &game) = 0;
+
+    // Voleur : index du trésor à prendre parmi les cartes révélées, -1 pour aucun
+    //  窃贼: 在揭示的财宝牌中选择要获得的索引, -1 表示不选
+    virtual int chooseThiefTreasure(const Player &player, const Game &game, const Player &victim,
+                                    const std::vector<CardId> &treasures) = 0;
+};
@@ -0,0 +1,64 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Card.h"
+#include "Random.h"
+
+// Pioche : nombre de cartes restantes par type de carte, sans ordre
+// L'ordre d'un deck mélangé n'a d'importance qu'au moment de piocher : chaque pioche est tirée
+// au hasard parmi les cartes restantes, le mélange complet disparaît
+// L'état tient dans un petit tableau de taille fixe, copiable et hachable directement
+//  牌堆: 按卡片类型记录剩余数量, 不保存顺序
+//  洗好的牌组的顺序只在抽牌时才有意义: 每次抽牌都从剩余的卡片中随机抽取, 不再需要完整洗牌
+//  状态是一个固定大小的小数组, 可以直接复制和哈希
+class Deck
+{
+private:
+    // Nombre de cartes restantes de chaque type
+    //  每种卡片的剩余数量
+    std::array<std::uint16_t, CardIds::COUNT> counts;
+    // Nombre total de cartes restantes
+    //  剩余卡片总数
+    std::uint16_t total;
+
+public:
+    Deck() { clear(); }
+
+    // Vider la pioche
+    //  清空牌堆
+    void clear();
+    // Ajouter count exemplaires d'une carte
+    //  加入 count 张某卡片
+    void add(CardId card, int count = 1);
+    // Ajouter toutes les cartes d'une zone
+    //  加入一个区域中的所有卡片
+    template <typename Zone>
+    void addAll(const Zone &cards)
+    {
+        for (CardId card : cards)
+        {
+            counts[card]++;
+        }
+        total += static_cast<std::uint16_t>(cards.size());
+    }
+    // Piocher une carte au hasard parmi les cartes restantes, CardIds::INVALID si la pioche est vide
+    //  从剩余卡片中随机抽一张, 牌堆为空时返回 CardIds::INVALID
+    CardId draw(Random &rng);
+    // Retirer un exemplaire d'une carte, renvoie false s'il n'y en a pas
+    //  移除一张某卡片, 没有时返回 false
+    bool remove(CardId card);
+
+    // Requête d'état
+    //  状态查询
+    int size() const { return total; }
+    bool empty() const { return total == 0; }
+    int count(CardId card) const { return counts[card]; }
+    // Cartes restantes dans l'ordre des identifiants (sauvegarde, affichage)
+    //  按标识顺序列出剩余卡片(存档, 显示)
+    std::vector<CardId> toVector() const;
+
+    bool operator==(const Deck &other) const { return total == other.total && counts == other.counts; }
+    bool operator!=(const Deck &other) const { return !(*this == other); }
+};
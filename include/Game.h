@@ -1,13 +1,19 @@
 #pragma once
+#include <array>
 #include <vector>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <fstream>
 #include <iomanip>
 #include "Player.h"
+#include "Supply.h"
 #include "Utils.h"
 #include "GameLogger.h"
+#include "Random.h"
+#include "Replay.h"
+#include "AutoSave.h"
 #include "nlohmann/json.hpp"
 
 class Card; // déclaration avant 向前声明
@@ -15,11 +21,39 @@ class Card; // déclaration avant 向前声明
 class Game
 {
 private:
+    // Mémoire de la partie : zones des joueurs, événements et textes du journal sont pris dans des pools
+    // alimentés par quelques grands blocs, libérés d'un coup avec la partie
+    // Non synchronisée : une partie (et ses copies de fork) n'est utilisée que par un thread à la fois
+    //  对局的内存: 玩家的各区域、日志的事件和文本从内存池中分配, 内存池由几个大块供给, 随对局一次性释放
+    //  不同步: 一个对局(及其 fork 副本)同一时间只由一个线程使用
+    struct Memory
+    {
+        static constexpr std::size_t INITIAL_BLOCK = 16 * 1024;
+        std::pmr::monotonic_buffer_resource blocks{INITIAL_BLOCK};
+        std::pmr::unsynchronized_pool_resource pool{&blocks};
+    };
+    // Déclarée en premier : détruite après tout ce qui y est alloué ; adresse stable quand la partie est déplacée
+    //  最先声明: 在其上分配的一切都析构之后才析构; 对局被移动时地址不变
+    std::unique_ptr<Memory> memory = std::make_unique<Memory>();
     std::vector<Player> players;
-    std::map<std::string, std::vector<std::shared_ptr<Card>>> supply;
+    Supply supply;
     int currentPlayer;
     int turnCount;
-    GameLogger logger;
+    GameLogger logger{true, &memory->pool};
+    // Graine de la partie et générateur dérivé (tirage du royaume, graines des joueurs)
+    //  对局种子及其生成器(随机王国卡, 玩家种子)
+    std::uint64_t seed;
+    Random rng;
+    // Afficher ou non le déroulement de la partie sur la console
+    //  是否在控制台输出游戏过程
+    bool verbose;
+    // Rejeu en cours d'enregistrement (nullptr si aucun)
+    //  正在记录的回放(没有时为 nullptr)
+    std::shared_ptr<Replay> replay;
+    // Sauvegarde automatique en arrière-plan (nullptr si désactivée) et intervalle en tours
+    //  后台自动存档(关闭时为 nullptr)及间隔回合数
+    std::unique_ptr<AutoSaver> autosaver;
+    int autosaveInterval = 0;
 
     std::vector<std::string> manualSelectCards();
     std::vector<std::string> selectPresetCards();
@@ -43,11 +77,105 @@ private:
     std::vector<std::string> extractKingdomCardsFromSupply(const json &supplyJson) const;
     void initializeFromSave(const json &saveData);
 
+    // Sauvegarde binaire versionnée (identifiants de cartes, compteurs, générateurs, statistiques)
+    //  带版本号的二进制存档(卡片标识、数量、生成器、统计信息)
+    void saveBinary(const std::string &filename) const;
+    // État de jeu au format binaire (sans journal) : corps de la sauvegarde et source de stateHash
+    //  二进制格式的游戏状态(不含日志): 存档的主体, 也是 stateHash 的来源
+    void writeState(BinaryWriter &out) const;
+    void loadBinary(const std::string &filename);
+    // Transmettre les noms des joueurs au journal (index des événements -> nom)
+    //  将玩家名称传给日志(事件索引 -> 名称)
+    void syncLoggerPlayers();
+    // Recopier les joueurs d'une autre partie par affectation : les zones restent dans la mémoire de cette partie
+    //  通过赋值复制另一局的玩家: 各区域保留在本局的内存中
+    void copyPlayersFrom(const std::vector<Player> &source);
+
+    // Copie de l'état de jeu seul (voir fork)
+    //  仅复制游戏状态(见 fork)
+    struct ForkTag
+    {
+    };
+    Game(const Game &other, ForkTag);
+    // Copie complète pour la sauvegarde automatique : état de jeu et journal, sans affichage
+    //  用于自动存档的完整副本: 游戏状态和日志, 不输出
+    struct SnapshotTag
+    {
+    };
+    Game(const Game &other, SnapshotTag);
+    // Confier un instantané de la partie au thread de sauvegarde automatique
+    //  将对局快照交给自动存档线程
+    void autosave();
+
 public:
     explicit Game(int numPlayers, bool isLoading = false, const std::string &kingdomSet = "");
+    // Partie sans saisie : noms des joueurs et cartes du royaume fournis directement
+    //  无输入的游戏: 直接提供玩家名称和王国卡
+    // La même graine rejoue exactement la même partie avec les mêmes décisions
+    //  相同的种子在相同决策下完全重现同一局
+    Game(const std::vector<std::string> &playerNames, const std::vector<std::string> &kingdomCards,
+         std::uint64_t seed = Random::randomSeed());
+    // Déplaçable mais pas réaffectable : les zones des joueurs gardent la mémoire de leur partie d'origine
+    //  可移动但不可重新赋值: 玩家的各区域保留其原对局的内存
+    Game(Game &&) = default;
+    Game &operator=(Game &&) = delete;
+
+    // Relancer une partie sans saisie dans cet objet, comme le constructeur ci-dessus, en gardant la capacité
+    // des zones : pour jouer des parties en boucle sans réallouer. Fournisseurs de décisions (remis à zéro par
+    // DecisionProvider::reset), affichage, sauvegarde automatique et journal en flux conservés ;
+    // l'enregistrement du rejeu s'arrête et les fournisseurs enveloppés par recordReplay sont remis en place
+    //  在本对象中重新开始无输入的对局, 与上面的构造函数相同, 但保留各区域的容量: 用于循环对局而无需重新分配
+    //  决策提供者(由 DecisionProvider::reset 清零)、显示、自动存档和流式日志保持不变;
+    //  回放记录停止, recordReplay 包装的提供者恢复原位
+    void reset(std::uint64_t seed, const std::vector<std::string> &kingdomCards,
+               const std::vector<std::string> &playerNames);
 
     void initialize();
     void playGame();
+    bool runHeadless(int maxTurns = 0);
+
+    // Copie indépendante de l'état de jeu pour la recherche (anticipation, MCTS) :
+    // réserve, joueurs, tour et générateurs ; sans journal ni affichage console
+    // Les fournisseurs de décisions sont partagés avec la partie d'origine
+    //  用于搜索(前瞻, MCTS)的独立游戏状态副本:
+    //  供应堆、玩家、回合和随机数生成器; 不含日志和控制台输出
+    //  决策提供者与原游戏共享
+    Game fork() const;
+    // Empreinte de l'état de jeu (réserve, joueurs, tour, générateurs), sans le journal
+    //  游戏状态的哈希(供应堆、玩家、回合、生成器), 不含日志
+    std::uint64_t stateHash() const;
+    // Enregistrer toutes les décisions de la partie dans un rejeu
+    // Partie sans saisie seulement, après setDecisionProvider et avant le premier tour
+    //  将本局的所有决策记录到回放中
+    //  仅限无输入对局, 在 setDecisionProvider 之后、第一回合之前调用
+    void recordReplay(int maxTurns = 0);
+    // Rejeu enregistré, avec l'empreinte de l'état actuel ; exception si recordReplay n'a pas été appelé
+    //  已记录的回放, 附带当前状态的哈希; 未调用 recordReplay 时抛出异常
+    Replay getReplay() const;
+    // Cartes du royaume de la réserve, dans l'ordre des identifiants
+    //  供应堆中的王国卡, 按标识顺序
+    std::vector<std::string> getKingdomCards() const;
+    // Recopier l'état de jeu d'une autre partie en réutilisant la mémoire déjà allouée
+    // (journal et affichage de cette partie inchangés) : sans allocation une fois les zones dimensionnées
+    //  复制另一局的游戏状态, 复用已分配的内存
+    //  (本局的日志和显示设置不变): 区域容量足够后无内存分配
+    void copyStateFrom(const Game &other);
+
+    // Phase du tour à partir de laquelle reprendre une copie
+    //  从哪个回合阶段继续副本
+    enum class TurnPhase
+    {
+        ACTION,
+        BUY
+    };
+    // Terminer le tour en cours à partir de la phase donnée, puis passer au joueur suivant
+    //  从指定阶段完成当前回合, 然后切换到下一个玩家
+    void finishTurn(TurnPhase from);
+    // Remélanger ce que le joueur observer ne peut pas voir (ordre des pioches, mains adverses)
+    // et réinitialiser les générateurs : chaque playout d'une copie explore un futur différent
+    //  重新洗混 observer 玩家看不到的信息(牌堆顺序, 对手手牌)
+    //  并重置生成器: 副本的每次模拟探索不同的未来
+    void randomizeHiddenState(std::uint64_t seed, int observer);
     void playTurn();
     bool isGameOver() const;
 
@@ -59,9 +187,31 @@ public:
     int getEmptyPiles() const;
     std::vector<std::pair<std::string, int>> calculateFinalScores() const;
 
+    // Format choisi par l'extension : binaire pour BINARY_SAVE_EXTENSION, JSON sinon
+    //  根据扩展名选择格式: BINARY_SAVE_EXTENSION 为二进制, 否则为 JSON
     void saveGame(const std::string &filename);
     void loadGame(const std::string &filename);
-    void logAction(const std::string &playerName, const std::string &action);
+    static const std::string BINARY_SAVE_EXTENSION;
+    static bool isBinarySaveFile(const std::string &filename);
+    // Journal en flux dans un fichier en ajout seul (vide : journal en mémoire) : les sauvegardes n'en
+    // gardent que la position, mémoire et temps de sauvegarde constants quelle que soit la durée de la partie
+    //  将日志流式写入仅追加的文件(空: 日志保存在内存中): 存档只保留其位置,
+    //  无论对局多长, 内存和存档时间都保持不变
+    void streamLog(const std::string &filename);
+    // Limiter le journal en mémoire à maxEvents événements (0 : pas de limite) ; sans fichier, les plus anciens sont oubliés
+    //  将内存中的日志限制为 maxEvents 个事件(0: 不限制); 没有文件时, 丢弃最旧的事件
+    void setLogCapacity(std::size_t maxEvents);
+    // Sauvegarde automatique tous les everyTurns tours (0 : désactivée), format choisi par l'extension
+    // Le tour ne fait qu'une copie de l'état ; l'encodage et l'écriture ont lieu en arrière-plan
+    //  每 everyTurns 回合自动存档(0: 关闭), 根据扩展名选择格式
+    //  回合中只复制状态; 编码和写入在后台进行
+    void setAutosave(const std::string &filename, int everyTurns);
+    // Attendre que la dernière sauvegarde automatique soit écrite ; exception si elle a échoué
+    //  等待最近一次自动存档写入完成; 失败时抛出异常
+    void flushAutosave();
+    // Enregistrer un événement typé du joueur au tour courant (texte mis en forme plus tard)
+    //  记录玩家在当前回合的类型化事件(文本稍后格式化)
+    void logEvent(GameEventKind kind, const Player &player, CardId card = CardIds::INVALID, int amount = 0);
 
     void otherPlayersDiscardToThree(const Player &currentPlayer);
     void otherPlayersDraw(const Player &currentPlayer, int count);
@@ -69,6 +219,22 @@ public:
 
     void showSupplyCardDescription(const std::string &cardName) const;
     void displaySupplyPiles() const;
+    void displayGainableCards(int maxCost) const;
+
+    // Décisions et affichage
+    //  决策与显示
+    void setDecisionProvider(size_t playerIndex, std::shared_ptr<DecisionProvider> provider);
+    void setVerbose(bool value);
+    bool isVerbose() const { return verbose; }
+
+    // Requête d'état pour les fournisseurs de décisions
+    //  供决策提供者使用的状态查询
+    int getTurnCount() const { return turnCount; }
+    std::uint64_t getSeed() const { return seed; }
+    int getCurrentPlayerIndex() const { return currentPlayer; }
+    const std::vector<Player> &getPlayers() const { return players; }
+    const GameLogger &getLogger() const { return logger; }
+    int getSupplyCount(CardId cardId) const;
 
     std::string getCurrentPlayerName() const
     {
@@ -95,7 +261,10 @@ public:
     void resolveChapelEffect(Player &currentPlayer);
     int calculateGardensPoints(const Player &player) const;
 
-    static const std::vector<std::string> ALL_KINGDOM_CARDS;
+    // Toutes les cartes du royaume disponibles, générées depuis CARD_DEFINITIONS
+    //  所有可用的王国卡, 由 CARD_DEFINITIONS 生成
+    static constexpr std::array<const char *, KINGDOM_CARD_COUNT> ALL_KINGDOM_CARDS = kingdomCardNames();
+    static std::vector<std::string> getFixedKingdomSet(const std::string &setName);
 
     void displaySupplyStatus() const;
     void displayPlayerStatus(const Player &player) const;
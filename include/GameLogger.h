@@ -1,64 +1,255 @@
 #pragma once
+#include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <map>
+#include <memory_resource>
+#include <memory>
 #include <ctime>
+#include <fstream>
 #include <nlohmann/json.hpp>
+#include "Card.h"
 
 using json = nlohmann::json;
 
+class BinaryWriter;
+class BinaryReader;
+
+// Nature d'un événement du journal
+//  日志事件的类型
+enum class GameEventKind : std::uint8_t
+{
+    TEXT,         // Texte libre (amount : index dans la table des textes)
+                  //  自由文本(amount: 文本表中的索引)
+    CARD_PLAYED,  // Carte action jouée (amount : détail propre à la carte)
+                  //  使用行动卡(amount: 卡片自身的细节)
+    CARD_BOUGHT,  // Carte achetée (amount : coût)
+                  //  购买卡片(amount: 花费)
+    CARD_GAINED,  // Carte obtenue (Atelier, Festin)
+                  //  获得卡片(工场, 盛宴)
+    CARD_TRASHED, // Carte écartée de la main
+                  //  从手牌中废除卡片
+    CARD_STOLEN,  // Trésor volé (amount : index de la victime)
+                  //  偷取财宝(amount: 受害者索引)
+    CURSE_GAINED, // Malédiction reçue
+                  //  获得诅咒
+    MOAT_BLOCKED, // Attaque parée par les Douves (card : carte d'attaque)
+                  //  护城河防御攻击(card: 攻击卡)
+    CARDS_DRAWN   // Cartes piochées hors de son tour (amount : nombre)
+                  //  在非自己回合抽牌(amount: 数量)
+};
+
+// Événement du journal : 8 octets, sans allocation
+//  日志事件: 8字节, 无内存分配
+struct GameEvent
+{
+    GameEventKind kind;
+    std::uint8_t player; // Index du joueur, SYSTEM_PLAYER pour le système
+                         //  玩家索引, 系统事件为 SYSTEM_PLAYER
+    CardId card;
+    std::int16_t amount;
+    std::int16_t turn;
+};
+
+// Fichier du journal en flux, ouvert en ajout seul
+// offset : nombre d'octets déjà écrits, c'est ce que les sauvegardes retiennent du journal
+// Une copie garde le nom et la position mais pas le fichier : seule la partie d'origine y écrit
+// (les instantanés de sauvegarde automatique sont copiés puis écrits sur un autre thread)
+//  以仅追加方式打开的流式日志文件
+//  offset: 已写入的字节数, 存档只记录日志的这个位置
+//  副本保留文件名和位置, 但不保留文件: 只有原对局写入文件
+//  (自动存档的快照被复制后在另一个线程上写入)
+class LogStream
+{
+private:
+    std::string filename;
+    std::uint64_t offset = 0;
+    std::unique_ptr<std::ofstream> file;
+
+public:
+    LogStream() = default;
+    LogStream(const LogStream &other) : filename(other.filename), offset(other.offset) {}
+    LogStream &operator=(const LogStream &other)
+    {
+        filename = other.filename;
+        offset = other.offset;
+        file.reset();
+        return *this;
+    }
+    LogStream(LogStream &&) = default;
+    LogStream &operator=(LogStream &&) = default;
+
+    // Ouvrir filename en ajout, sans jamais rien effacer ; resumeAt : position enregistrée par la sauvegarde
+    // reprise, APPEND pour une simple suite. Si le fichier ne s'arrête pas à resumeAt (sauvegarde plus ancienne
+    // que la fin du journal), une ligne de reprise sépare la suite de ce qui a été écrit après la sauvegarde
+    // Exception si le fichier ne peut pas être ouvert
+    //  以追加方式打开 filename, 从不删除任何内容; resumeAt: 所恢复存档记录的位置, APPEND 表示直接续写
+    //  如果文件不是在 resumeAt 处结束(存档比日志末尾旧), 用一行恢复标记把续写内容与存档之后写入的内容分开
+    //  无法打开文件时抛出异常
+    static constexpr std::uint64_t APPEND = ~std::uint64_t(0);
+    void open(const std::string &name, std::uint64_t resumeAt = APPEND);
+    void close();
+    // Écrire un bloc de lignes et le vider sur le disque, exception en cas d'échec
+    //  写入一组行并刷新到磁盘, 失败时抛出异常
+    void write(const std::string &block);
+
+    bool isOpen() const { return file != nullptr; }
+    const std::string &getFilename() const { return filename; }
+    std::uint64_t getOffset() const { return offset; }
+};
+
 class GameLogger
 {
+public:
+    // Index de joueur des événements du système
+    //  系统事件的玩家索引
+    static constexpr std::uint8_t SYSTEM_PLAYER = 0xFF;
+
 private:
-    // Conteneur pour stocker les journaux
-    //  存储日志的容器
-    std::vector<std::string> logs;
-    // Conteneur pour stocker les cartes achetées
-    //  存储购买的卡片的容器
-    std::map<std::string, int> cardsBought;
-    // Conteneur pour stocker les cartes utilisées
-    //  存储使用过的卡片的容器
-    std::map<std::string, int> cardsPlayed;
+    // Lignes déjà mises en forme (journal repris d'une ancienne sauvegarde JSON)
+    //  已格式化的日志行(从旧的JSON存档恢复的日志)
+    std::vector<std::string> history;
+    // Événements typés, mis en forme seulement à l'affichage ou à la sauvegarde
+    //  类型化的事件, 仅在显示或保存时格式化
+    std::pmr::vector<GameEvent> events;
+    // Textes libres référencés par les événements TEXT : seuls les textCount premiers sont utilisés,
+    // les chaînes suivantes restent allouées pour être réécrites (Game::reset sans allocation)
+    //  TEXT 事件引用的自由文本: 只使用前 textCount 个, 之后的字符串保留分配以便重写(Game::reset 无内存分配)
+    std::pmr::vector<std::pmr::string> texts;
+    std::size_t textCount = 0;
+    // Noms des joueurs, pour la mise en forme
+    //  玩家名称, 用于格式化
+    std::vector<std::string> playerNames;
+    // Nombre d'achats et d'utilisations par carte
+    //  每种卡片的购买和使用次数
+    std::array<int, CardIds::COUNT> cardsBought{};
+    std::array<int, CardIds::COUNT> cardsPlayed{};
     // Variable pour enregistrer l'heure de début du jeu
     //  记录游戏开始时间的变量
     std::time_t startTime;
+    // Journal actif (désactivé pour les copies de recherche)
+    //  日志是否启用(搜索用的副本中关闭)
+    bool enabled;
+    // Nombre maximal d'événements gardés en mémoire (0 : pas de limite)
+    // Au-delà, les événements partent dans le fichier du journal, ou, sans fichier, les plus anciens sont oubliés
+    //  内存中保留的最大事件数(0: 不限制)
+    //  超过后, 事件被写入日志文件; 没有文件时, 丢弃最旧的事件
+    std::size_t capacity = 0;
+    LogStream stream;
+
+    // Mettre un événement en forme
+    //  格式化一个事件
+    std::string render(const GameEvent &event) const;
+    // Mémoire pleine : écrire les événements dans le fichier, ou garder seulement la moitié la plus récente
+    //  内存已满: 将事件写入文件, 或只保留较新的一半
+    void spill();
+    // Texte libre suivant : remplir la chaîne renvoyée (capacité réutilisée), puis commitText l'enregistre
+    //  下一个自由文本: 填写返回的字符串(复用容量), 然后由 commitText 记录
+    std::pmr::string &nextText();
+    void commitText(int player, int turn);
 
 public:
-    GameLogger() : startTime(std::time(nullptr)) {}
+    // Un journal désactivé n'enregistre rien et n'alloue rien ; événements et textes sont alloués sur memory
+    //  关闭的日志不记录也不分配内存; 事件和文本在 memory 上分配
+    explicit GameLogger(bool enabled = true, std::pmr::memory_resource *memory = std::pmr::get_default_resource())
+        : events(memory), texts(memory), startTime(std::time(nullptr)), enabled(enabled)
+    {
+        if (enabled)
+            events.reserve(1024);
+    }
+    // Les événements encore en mémoire sont écrits dans le fichier du journal
+    //  仍在内存中的事件被写入日志文件
+    ~GameLogger();
+    GameLogger(const GameLogger &) = default;
+    GameLogger(GameLogger &&) = default;
+    GameLogger &operator=(const GameLogger &) = default;
+    GameLogger &operator=(GameLogger &&) = default;
+
+    // Capacité par défaut quand le journal est envoyé dans un fichier
+    //  日志写入文件时的默认容量
+    static constexpr std::size_t DEFAULT_STREAM_CAPACITY = 1024;
+    // Fonction : Limiter le journal en mémoire à maxEvents événements (0 : pas de limite)
+    //  作用: 将内存中的日志限制为 maxEvents 个事件(0: 不限制)
+    void setCapacity(std::size_t maxEvents);
+    // Fonction : Envoyer le journal dans un fichier en ajout seul (vide : arrêter)
+    // Les sauvegardes ne contiennent plus que le nom du fichier, sa position et les lignes pas encore écrites
+    //  作用: 将日志写入仅追加的文件(空: 停止)
+    //  存档只包含文件名、其位置以及尚未写入的行
+    void streamTo(const std::string &filename);
+    // Fonction : Écrire dans le fichier les événements encore en mémoire
+    //  作用: 将仍在内存中的事件写入文件
+    void flush();
 
-    // méthode de journalisation
-    // Fonction : Enregistrer les actions du joueur -utilisé pour enregistrer les actions du joueur
-    //  日志记录方法
-    // 作用: 记录玩家动作 - 用于记录玩家动作
-    void logAction(const std::string &playerName, const std::string &action);
+    // Fonction : Enregistrer un événement -quelques nanosecondes, aucun texte construit
+    //  作用: 记录一个事件 - 几纳秒, 不构造任何文本
+    void logEvent(GameEventKind kind, int player, int turn, CardId card = CardIds::INVALID, int amount = 0)
+    {
+        if (!enabled)
+            return;
+        events.push_back({kind, static_cast<std::uint8_t>(player), card,
+                          static_cast<std::int16_t>(amount), static_cast<std::int16_t>(turn)});
+        if (capacity != 0 && events.size() >= capacity)
+            spill();
+    }
+    // Fonction : Enregistrer un texte libre (messages du système, rares)
+    //  作用: 记录自由文本(系统消息, 很少使用)
+    void logText(int player, int turn, const std::string &text);
     // Fonction : Carte pour enregistrer les achats -Carte utilisée pour enregistrer les achats
     //  作用: 记录购买的卡片 - 用于记录购买的卡片
-    void recordCardBought(const std::string &cardName);
-    // Fonction : Enregistrer les cartes utilisées -Utilisé pour enregistrer les cartes utilisées
+    void recordCardBought(CardId card)
+    {
+        if (enabled)
+            cardsBought[card]++;
+    }
+    // Fonction : Enregistrer les cartes utilisées -Utilisé pour enregistrer les cartes utilisées
     //  作用: 记录使用过的卡片 - 用于记录使用过的卡片
-    void recordCardPlayed(const std::string &cardName);
-    // Fonction : Enregistrer la carte du Royaume sélectionnée -Utilisé pour enregistrer la carte du Royaume sélectionnée
+    void recordCardPlayed(CardId card)
+    {
+        if (enabled)
+            cardsPlayed[card]++;
+    }
+    // Fonction : Enregistrer la carte du Royaume sélectionnée -Utilisé pour enregistrer la carte du Royaume sélectionnée
     //  作用: 记录选择的王国卡 - 用于记录选择的王国卡
     void logKingdomCardSelection(const std::vector<std::string> &cards);
+    // Fonction : Définir les noms des joueurs (index des événements -> nom), en réutilisant les chaînes existantes
+    //  作用: 设置玩家名称(事件索引 -> 名称), 复用已有的字符串
+    void setPlayerCount(std::size_t count) { playerNames.resize(count); }
+    void setPlayerName(std::size_t index, const std::string &name) { playerNames.at(index) = name; }
+    // Fonction : Revenir à un journal vide pour une nouvelle partie, capacité gardée
+    // (en flux, les événements en mémoire sont d'abord écrits dans le fichier, qui continue)
+    //  作用: 为新对局恢复为空日志, 保留容量(流式时, 内存中的事件先写入文件, 文件继续使用)
+    void reset();
 
     // Méthode de sérialisation JSON
-    // Fonction : Convertir les journaux au format JSON -Utilisé pour convertir les journaux au format JSON
+    // Fonction : Convertir les journaux au format JSON -Utilisé pour convertir les journaux au format JSON
     //  JSON序列化方法
     // 作用: 将日志转换为JSON格式 - 用于将日志转换为JSON格式
     json toJson() const;
     // Fonction : Restaurer les logs depuis le format JSON -Utilisé pour restaurer les logs depuis le format JSON
     //  作用: 从JSON格式中恢复日志 - 用于从JSON格式中恢复日志
     void fromJson(const json &j);
+    // Sauvegarde binaire : heure de début et statistiques, puis le fichier du journal en flux
+    // (nom, position, lignes pas encore écrites) ; sans flux, pas de texte du journal
+    // version : version de la sauvegarde, le flux n'existe qu'à partir de la version 2
+    //  二进制存档: 开始时间和统计信息, 然后是流式日志文件(名称, 位置, 尚未写入的行); 没有流时不含日志文本
+    //  version: 存档版本, 从版本 2 开始才有日志流
+    void toBinary(BinaryWriter &out) const;
+    void fromBinary(BinaryReader &in, std::uint16_t version);
 
     // getteur
-    // Fonction : Obtenir le journal -utilisé pour obtenir le journal
+    // Fonction : Obtenir le journal mis en forme -construit à chaque appel (en flux : lignes pas encore écrites)
     //  获取器
-    // 作用: 获取日志 - 用于获取日志
-    const std::vector<std::string> &getLogs() const { return logs; }
+    // 作用: 获取格式化的日志 - 每次调用时构造(流式时: 尚未写入的行)
+    std::vector<std::string> getLogs() const;
+    // Fonction : Obtenir les événements bruts
+    //  作用: 获取原始事件
+    const std::pmr::vector<GameEvent> &getEvents() const { return events; }
+    const LogStream &getStream() const { return stream; }
     // Fonction : Récupérer la carte achetée -Utilisé pour récupérer la carte achetée
     //  作用: 获取购买的卡片 - 用于获取购买的卡片
-    const std::map<std::string, int> &getCardsBought() const { return cardsBought; }
-    // Fonction : Récupérer les cartes utilisées -Utilisé pour récupérer les cartes utilisées
+    std::map<std::string, int> getCardsBought() const;
+    // Fonction : Récupérer les cartes utilisées -Utilisé pour récupérer les cartes utilisées
     //  作用: 获取使用过的卡片 - 用于获取使用过的卡片
-    const std::map<std::string, int> &getCardsPlayed() const { return cardsPlayed; }
-};
\ No newline at end of file
+    std::map<std::string, int> getCardsPlayed() const;
+};
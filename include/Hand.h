@@ -0,0 +1,98 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+#include "Card.h"
+
+// Zone de cartes d'un joueur (main, défausse, en jeu, écart) : allouée sur la mémoire de sa partie
+//  玩家的卡片区域(手牌、弃牌堆、场上、废弃堆): 在其对局的内存上分配
+using CardZone = std::pmr::vector<CardId>;
+
+// Main d'un joueur : les cartes dans l'ordre (affichage, choix par index) et, en plus, le nombre
+// d'exemplaires de chaque carte et le masque des cartes présentes
+// "A une carte action", "a des Douves", "contient X" sont en temps constant, sans parcourir la main
+//  玩家的手牌: 按顺序保存的卡片(显示, 按索引选择), 另外还有每种卡片的数量和在手卡片的掩码
+//  "有行动卡"、"有护城河"、"包含X" 都是常数时间, 无需遍历手牌
+class Hand
+{
+private:
+    CardZone cards;
+    // Nombre d'exemplaires de chaque carte en main
+    //  手牌中每种卡片的数量
+    std::array<std::uint8_t, CardIds::COUNT> counts{};
+    // Bit id à 1 si au moins un exemplaire de la carte est en main
+    //  手牌中至少有一张该卡时第 id 位为1
+    std::uint32_t present = 0;
+
+    void counted(CardId card)
+    {
+        counts[card]++;
+        present |= 1u << card;
+    }
+    void uncounted(CardId card)
+    {
+        if (--counts[card] == 0)
+            present &= ~(1u << card);
+    }
+
+public:
+    // Main vide dont les cartes sont allouées sur memory
+    //  空手牌, 卡片在 memory 上分配
+    explicit Hand(std::pmr::memory_resource *memory = std::pmr::get_default_resource()) : cards(memory) {}
+
+    // Ajouter une carte à la fin de la main
+    //  在手牌末尾加入一张卡
+    void add(CardId card)
+    {
+        cards.push_back(card);
+        counted(card);
+    }
+    // Retirer la carte à l'index donné et la renvoyer
+    //  移除指定索引处的卡片并返回它
+    CardId removeAt(std::size_t index);
+    // Retirer un exemplaire d'une carte, renvoie false si elle n'est pas en main
+    //  移除一张某卡片, 不在手牌中时返回 false
+    bool remove(CardId card);
+    // Vider la main
+    //  清空手牌
+    void clear();
+    // Réserver la place de count cartes, en une fois dans la mémoire de la partie : piocher et jouer
+    // ne font ensuite que déplacer des octets dans la main, sans réallocation
+    //  在对局内存中一次性预留 count 张卡的空间: 之后抽牌和出牌只是在手牌中移动字节, 不会重新分配
+    void reserve(std::size_t count) { cards.reserve(count); }
+    // Retirer en un seul passage les cartes pour lesquelles take(card) renvoie true, l'ordre des autres est conservé
+    //  一次遍历移除 take(card) 返回 true 的卡片, 其余卡片保持顺序
+    template <typename Take>
+    void removeIf(Take take)
+    {
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < cards.size(); i++)
+        {
+            CardId card = cards[i];
+            if (take(card))
+                uncounted(card);
+            else
+                cards[kept++] = card;
+        }
+        cards.resize(kept);
+    }
+
+    // Requête d'état
+    //  状态查询
+    std::size_t size() const { return cards.size(); }
+    bool empty() const { return cards.empty(); }
+    CardId operator[](std::size_t index) const { return cards[index]; }
+    CardZone::const_iterator begin() const { return cards.begin(); }
+    CardZone::const_iterator end() const { return cards.end(); }
+    const CardZone &getCards() const { return cards; }
+
+    int count(CardId card) const { return counts[card]; }
+    // Faux pour un identifiant hors de la table (CardIds::INVALID compris)
+    //  表外的标识(包括 CardIds::INVALID)返回 false
+    bool contains(CardId card) const { return card < CardIds::COUNT && ((present >> card) & 1u); }
+    // Au moins une carte du type donné en main
+    //  手牌中至少有一张指定类型的卡
+    bool hasType(CardType type) const { return present & CARD_TYPE_MASKS[static_cast<int>(type)]; }
+};
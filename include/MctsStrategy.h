@@ -0,0 +1,88 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "BotStrategies.h"
+#include "Game.h"
+
+// Paramètres de la recherche Monte Carlo
+//  蒙特卡洛搜索的参数
+struct MctsConfig
+{
+    // Budget par décision : nombre de playouts (0 : limité par le temps seul)
+    //  每次决策的预算: 模拟次数(0: 仅受时间限制)
+    int iterations = 1000;
+    // Budget par décision en millisecondes (0 : limité par le nombre de playouts seul)
+    //  每次决策的预算(毫秒)(0: 仅受模拟次数限制)
+    double timeLimitMs = 0;
+    // Threads de recherche : chacun explore la racine indépendamment, les visites sont additionnées
+    //  搜索线程数: 每个线程独立探索根节点, 访问次数相加
+    int threads = 1;
+    // Stratégie de tous les joueurs pendant les playouts (voir BotStrategies::names)
+    //  模拟中所有玩家使用的策略(见 BotStrategies::names)
+    std::string rolloutStrategy = "smithy";
+    // Constante d'exploration UCB1
+    //  UCB1 探索常数
+    double exploration = 0.7;
+    // Tours joués au plus par playout, la partie est ensuite évaluée aux points
+    //  每次模拟最多进行的回合数, 之后按分数评估
+    int rolloutTurns = 40;
+
+    // Lire une spécification "mcts[:N|:Nms][/T]" (N playouts ou N ms, T threads), exception si invalide
+    //  解析 "mcts[:N|:Nms][/T]" 规格(N次模拟或N毫秒, T个线程), 无效时抛出异常
+    static MctsConfig fromSpec(const std::string &spec);
+};
+
+// Statistiques cumulées des recherches
+//  搜索的累计统计
+struct MctsStats
+{
+    long long decisions = 0;
+    long long playouts = 0;
+    double seconds = 0;
+
+    double playoutsPerSecond() const { return seconds > 0 ? playouts / seconds : 0; }
+};
+
+// Joueur Monte Carlo : aux choix d'action et d'achat, chaque option de la racine est évaluée par des playouts
+// sur des copies de la partie (Game::fork), avec les vrais effets des cartes et une stratégie scriptée
+// Sélection UCB1 à la racine, information cachée remélangée à chaque playout, parallélisation à la racine
+// Les autres choix (Milice, Cave, Chapelle, Voleur, gains) suivent les règles communes des bots
+//  蒙特卡洛玩家: 在行动和购买选择时, 根节点的每个选项通过在游戏副本(Game::fork)上的模拟来评估,
+//  使用真实的卡片效果和脚本策略
+//  根节点使用 UCB1 选择, 每次模拟重新洗混隐藏信息, 根节点并行化
+//  其他选择(民兵、地窖、教堂、窃贼、获得)沿用机器人的共用规则
+class MctsStrategy : public BotStrategy
+{
+public:
+    explicit MctsStrategy(MctsConfig config = MctsConfig());
+
+    // Nouvelle partie : la numérotation des décisions (graines de recherche) repart de zéro
+    //  新对局: 决策编号(搜索种子)从零重新开始
+    void reset() override { gameDecisions = 0; }
+    CardId chooseAction(const Player &player, const Game &game) override;
+    CardId chooseBuy(const Player &player, const Game &game) override;
+
+    // Statistiques de cette instance
+    //  本实例的统计
+    const MctsStats &getStats() const { return stats; }
+    // Statistiques de toutes les instances du processus (rapport de dominion-sim)
+    //  进程中所有实例的统计(dominion-sim 的报告)
+    static MctsStats totalStats();
+
+protected:
+    // Gains d'Atelier/Festin : Big Money
+    //  工场/盛宴的获得: 大钱策略
+    CardId pickCard(const Player &player, const Game &game, int coins) const override;
+
+private:
+    MctsConfig config;
+    MctsStats stats;
+    // Décisions prises dans la partie en cours : avec la graine de la partie, donne la graine de chaque recherche
+    //  当前对局中已做的决策数: 与对局种子一起得出每次搜索的种子
+    long long gameDecisions = 0;
+
+    // Chercher la meilleure option parmi candidates, à partir de la phase donnée du tour en cours
+    //  从当前回合的指定阶段开始, 在 candidates 中搜索最佳选项
+    CardId search(const Player &player, const Game &game, Game::TurnPhase phase,
+                  const std::vector<CardId> &candidates);
+};
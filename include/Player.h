@@ -1,32 +1,82 @@
 #pragma once
+#include <array>
 #include <vector>
 #include <memory>
 #include <string>
 #include <fstream>
 #include "Card.h"
+#include "DecisionProvider.h"
+#include "Deck.h"
+#include "Hand.h"
+#include "Random.h"
 
+class BinaryWriter;
+class BinaryReader;
 class Game; // déclaration avant
             //  前向声明
 
 class Player
 {
 private:
+    // Capacités réservées à la construction, en une fois dans la mémoire de la partie : dans une partie
+    // ordinaire, piocher, jouer et défausser ne font que déplacer des octets dans ces zones, sans réallocation
+    //  构造时在对局内存中一次性预留的容量: 普通对局中, 抽牌、出牌和弃牌只是在这些区域中移动字节, 不会重新分配
+    static constexpr std::size_t HAND_CAPACITY = 16;
+    static constexpr std::size_t IN_PLAY_CAPACITY = 16;
+    static constexpr std::size_t DISCARD_CAPACITY = 64;
+
     std::string name;
-    std::vector<std::shared_ptr<Card>> deck;
-    std::vector<std::shared_ptr<Card>> hand;
-    std::vector<std::shared_ptr<Card>> discard;
-    std::vector<std::shared_ptr<Card>> trash;
+    // Pioche : comptes par carte, chaque pioche est tirée au hasard (pas d'ordre stocké)
+    //  牌堆: 按卡片计数, 每次抽牌随机抽取(不保存顺序)
+    Deck deck;
+    // Main : ordre des cartes et compteurs par carte (requêtes en temps constant)
+    //  手牌: 卡片顺序和每种卡片的计数(常数时间查询)
+    Hand hand;
+    CardZone discard;
+    // Cartes jouées ce tour, défaussées seulement à la phase de nettoyage
+    //  本回合已使用的卡, 只在清理阶段弃置
+    CardZone inPlay;
+    CardZone trash;
     int actions;
     int buys;
     int coins;
+    // La carte en cours d'effet a été écartée (Festin) et ne va pas à la défausse
+    //  正在结算的卡已被废弃(盛宴), 不进入弃牌堆
+    bool playedCardTrashed;
+    // Source des décisions du joueur (terminal par défaut)
+    //  玩家决策来源(默认为终端)
+    std::shared_ptr<DecisionProvider> decisions;
+    // Afficher ou non les messages sur la console
+    //  是否在控制台输出信息
+    bool verbose;
+    // Nombre d'exemplaires possédés de chaque carte (pioche, main, défausse, en jeu),
+    // total et points de victoire hors Jardins, tenus à jour à chaque gain et à chaque écart
+    //  每种卡拥有的数量(牌堆、手牌、弃牌堆、场上)、总数和不含花园的胜利点数,
+    //  在每次获得和废弃时更新
+    std::array<int, CardIds::COUNT> ownedCounts;
+    int totalCards;
+    int baseVictoryPoints;
+    // Générateur des mélanges du joueur, initialisé par Game à partir de la graine de la partie
+    //  玩家洗牌用的生成器, 由 Game 根据对局种子初始化
+    Random rng;
 
 public:
-    explicit Player(const std::string &name);
+    // Zones allouées sur memory (la mémoire de la partie) ; une copie utilise la mémoire par défaut,
+    // une affectation garde la mémoire de la destination
+    //  各区域在 memory(对局的内存)上分配; 副本使用默认内存, 赋值保留目标的内存
+    explicit Player(const std::string &name, std::pmr::memory_resource *memory = std::pmr::get_default_resource());
+    // Revenir à un joueur neuf (sans cartes) en gardant la capacité des zones ; fournisseur de décisions,
+    // affichage et générateur inchangés (Game::initialize le réinitialise)
+    //  恢复为新玩家(没有卡片), 保留各区域的容量; 决策提供者、显示和生成器不变(由 Game::initialize 重新初始化)
+    void reset(const std::string &playerName);
 
     // Opérations de base
     //  基础操作
     void drawCard(int count = 1);
     void shuffleDeck();
+    // Nouvelle graine pour les pioches à venir, et main retirée de la pioche si includeHand, pour les copies de recherche
+    //  为之后的抽牌设置新种子, includeHand 时从牌堆中重新抽取手牌, 用于搜索副本
+    void shuffleHidden(std::uint64_t seed, bool includeHand);
     void discardHand();
     void initializeDeck();
 
@@ -41,6 +91,16 @@ public:
     void addAction(int amount) { actions += amount; }
     void addBuy(int amount) { buys += amount; }
     void addCoin(int amount) { coins += amount; }
+    // Noyau des effets fixes d'une carte : +actions, +achats, +pièces, puis +cartes, sans appel virtuel
+    //  卡片固定效果的内核: +行动, +购买, +金币, 然后+卡片, 无虚函数调用
+    void applyEffect(const CardEffect &effect)
+    {
+        actions += effect.actions;
+        buys += effect.buys;
+        coins += effect.coins;
+        if (effect.cards)
+            drawCard(effect.cards);
+    }
     void useAction()
     {
         if (actions > 0)
@@ -61,21 +121,31 @@ public:
 
     // Fonctionnement du pont
     //  牌组操作
-    void addToDiscard(std::shared_ptr<Card> card) { discard.push_back(card); }
-    void addToDeck(std::shared_ptr<Card> card) { deck.push_back(card); }
-    void addToHand(std::shared_ptr<Card> card) { hand.push_back(card); }
+    void addToDiscard(CardId card) { discard.push_back(card); }
+    void addToDeck(CardId card) { deck.add(card); }
+    void addToHand(CardId card) { hand.add(card); }
+    void addToPlay(CardId card) { inPlay.push_back(card); }
     void discardCard(int index);
     void discardCellar();
-    void discardDownTo(int count);
-    int discardAndDraw();
+    void discardDownTo(int count, const Game &game);
+    int discardAndDraw(const Game &game);
+    // Gagner une carte (achat, Atelier, Malédiction...) : défausse et compteurs
+    //  获得一张卡(购买、工场、诅咒...): 放入弃牌堆并更新计数
+    void gainCard(CardId card);
+    // La carte a quitté les zones du joueur sans être écartée par lui (prise par le Voleur)
+    //  该卡已离开玩家的区域, 但不是由玩家废弃的(被窃贼拿走)
+    void loseCard(CardId card);
+    // Recalculer les compteurs à partir des zones (après chargement)
+    //  根据各区域重新计算计数(加载之后)
+    void recountCards();
     bool trashCopperFromHand();
     void trashCardFromHand(size_t index);
     void trashCardFromDeck(size_t index);
 
     // action du jeu
     //  游戏动作
-    bool playAction(const std::string &cardName, Game &game);
-    bool playTreasure(const std::string &cardName);
+    bool playAction(CardId cardId, Game &game);
+    bool playTreasure(CardId cardId);
     void playAllTreasures();
     bool hasActionCard() const;
     bool hasMoat() const;
@@ -87,13 +157,33 @@ public:
     int getBuys() const { return buys; }
     int getCoins() const { return coins; }
     int getHandSize() const { return hand.size(); }
-    const std::vector<std::shared_ptr<Card>> &getHand() const { return hand; }
-    std::vector<std::shared_ptr<Card>> &getHand() { return hand; }
-    const std::vector<std::shared_ptr<Card>> &getDeck() const { return deck; }
-    std::vector<std::shared_ptr<Card>> &getDeck() { return deck; }
-    const std::vector<std::shared_ptr<Card>> &getDiscard() const { return discard; }
-    std::vector<std::shared_ptr<Card>> getAllCards() const;
-    std::vector<std::shared_ptr<Card>> getTreasureCards() const;
+    const Hand &getHand() const { return hand; }
+    Hand &getHand() { return hand; }
+    const Deck &getDeck() const { return deck; }
+    Deck &getDeck() { return deck; }
+    const CardZone &getDiscard() const { return discard; }
+    CardZone &getDiscard() { return discard; }
+    const CardZone &getInPlay() const { return inPlay; }
+    CardZone &getInPlay() { return inPlay; }
+    std::vector<CardId> getAllCards() const;
+    // Décompte en temps constant
+    //  常数时间的计数
+    int getVictoryPoints() const;
+    int getCardCount() const { return totalCards; }
+    int getOwnedCount(CardId card) const { return ownedCounts[card]; }
+
+    // Source des décisions
+    //  决策来源
+    DecisionProvider &getDecisionProvider() const { return *decisions; }
+    const std::shared_ptr<DecisionProvider> &getDecisionProviderPtr() const { return decisions; }
+    void setDecisionProvider(std::shared_ptr<DecisionProvider> provider) { decisions = std::move(provider); }
+    bool isVerbose() const { return verbose; }
+    void setVerbose(bool value) { verbose = value; }
+
+    // Générateur aléatoire
+    //  随机数生成器
+    void seedRandom(std::uint64_t seed) { rng.reseed(seed); }
+    Random &getRandom() { return rng; }
 
     // Lié aux archives
     // void saveState(std::ofstream& out) const;
@@ -103,6 +193,16 @@ public:
     // void loadState(std::ifstream& in);
     json toJson() const;
     void fromJson(const json &j);
+    // Sauvegarde binaire compacte (un octet par carte)
+    //  紧凑的二进制存档(每张卡一个字节)
+    void toBinary(BinaryWriter &out) const;
+    void fromBinary(BinaryReader &in);
 
-    void addToTrash(std::shared_ptr<Card> card) { trash.push_back(card); }
+    void addToTrash(CardId card) { trash.push_back(card); }
+    void trashPlayedCard(CardId card)
+    {
+        trash.push_back(card);
+        playedCardTrashed = true;
+        loseCard(card);
+    }
 };
\ No newline at end of file
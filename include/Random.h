@@ -0,0 +1,116 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <utility>
+
+// Générateur pseudo-aléatoire xoshiro256** : 32 octets d'état, initialisé par une graine 64 bits
+// Le mélange et le tirage sont implémentés ici (et non via std::shuffle / std::uniform_int_distribution)
+// afin qu'une même graine donne exactement la même partie sur toutes les bibliothèques standard
+//  xoshiro256** 伪随机数生成器: 32字节状态, 由64位种子初始化
+//  洗牌和抽取在这里实现(而不是 std::shuffle / std::uniform_int_distribution),
+//  以保证同一种子在所有标准库上得到完全相同的对局
+class Random
+{
+public:
+    using result_type = std::uint64_t;
+    using State = std::array<std::uint64_t, 4>;
+
+private:
+    State state;
+
+    static std::uint64_t rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    // SplitMix64 : dérive l'état initial à partir de la graine
+    //  SplitMix64: 从种子派生初始状态
+    static std::uint64_t splitMix(std::uint64_t &x)
+    {
+        std::uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+public:
+    explicit Random(std::uint64_t seed = 0) { reseed(seed); }
+
+    // Réinitialiser le générateur à partir d'une graine
+    //  用种子重置生成器
+    void reseed(std::uint64_t seed)
+    {
+        for (auto &word : state)
+        {
+            word = splitMix(seed);
+        }
+    }
+
+    // Nombre aléatoire suivant (64 bits)
+    //  下一个随机数(64位)
+    std::uint64_t operator()()
+    {
+        std::uint64_t result = rotl(state[1] * 5, 7) * 9;
+        std::uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    static constexpr std::uint64_t min() { return 0; }
+    static constexpr std::uint64_t max() { return ~std::uint64_t(0); }
+
+    // Entier uniforme dans [0, bound) (méthode de Lemire, sans division dans le cas courant)
+    //  [0, bound) 内的均匀整数(Lemire 方法, 常见情况下无除法)
+    std::uint32_t below(std::uint32_t bound)
+    {
+        std::uint64_t product = ((*this)() >> 32) * bound;
+        std::uint32_t low = static_cast<std::uint32_t>(product);
+        if (low < bound)
+        {
+            std::uint32_t threshold = static_cast<std::uint32_t>(-bound) % bound;
+            while (low < threshold)
+            {
+                product = ((*this)() >> 32) * bound;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+    // Entier uniforme dans [min, max]
+    //  [min, max] 内的均匀整数
+    int between(int min, int max)
+    {
+        return min + static_cast<int>(below(static_cast<std::uint32_t>(max - min + 1)));
+    }
+
+    // Mélange de Fisher-Yates de [first, last)
+    //  对 [first, last) 进行 Fisher-Yates 洗牌
+    template <typename RandomIt>
+    void shuffle(RandomIt first, RandomIt last)
+    {
+        auto count = static_cast<std::uint32_t>(std::distance(first, last));
+        for (std::uint32_t i = count; i > 1; i--)
+        {
+            using std::swap;
+            swap(first[i - 1], first[below(i)]);
+        }
+    }
+
+    // État complet, pour la sauvegarde et la reprise exacte
+    //  完整状态, 用于存档和精确恢复
+    const State &getState() const { return state; }
+    void setState(const State &value) { state = value; }
+
+    // Graine non déterministe (std::random_device), pour les parties sans graine imposée
+    //  非确定性种子(std::random_device), 用于未指定种子的对局
+    static std::uint64_t randomSeed()
+    {
+        std::random_device rd;
+        return (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+    }
+};
@@ -0,0 +1,107 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "DecisionProvider.h"
+
+// Rejeu compact d'une partie sans saisie : graine, joueurs, royaume et suite ordonnée des décisions
+// La même graine avec les mêmes décisions rejoue exactement la même partie ; l'empreinte de l'état final
+// (Game::stateHash) permet de vérifier qu'une version du moteur la rejoue à l'identique
+//  无输入对局的紧凑回放: 种子、玩家、王国卡和按顺序排列的决策
+//  相同的种子加上相同的决策完全重现同一局; 最终状态的哈希(Game::stateHash)
+//  用于验证某个版本的引擎是否完全一致地重现该局
+struct Replay
+{
+    std::vector<std::string> playerNames;
+    std::vector<std::string> kingdomCards;
+    std::uint64_t seed = 0;
+    // Limite de tours passée à Game::runHeadless (0 : aucune)
+    //  传给 Game::runHeadless 的回合上限(0: 无)
+    int maxTurns = 0;
+    // Décisions de tous les joueurs dans l'ordre où le moteur les a demandées
+    // Carte : identifiant (CardIds::INVALID pour passer) ; index : valeur (-1 pour aucun) ;
+    // Cave : nombre d'index puis les index
+    //  所有玩家的决策, 按引擎请求的顺序
+    //  卡片: 标识(跳过为 CardIds::INVALID); 索引: 数值(无为 -1); 地窖: 索引数量, 然后是各个索引
+    std::vector<std::int32_t> decisions;
+    std::uint64_t finalStateHash = 0;
+
+    // Fichier binaire : signature, version, puis décisions en entiers variables (un octet pour la plupart)
+    //  二进制文件: 签名, 版本, 然后是变长整数形式的决策(大多数只占一个字节)
+    static const std::string EXTENSION;
+    void save(const std::string &filename) const;
+    static Replay load(const std::string &filename);
+
+    // Rejouer sans affichage et renvoyer l'empreinte de l'état final
+    // Exception si le moteur demande plus de décisions que le rejeu n'en contient, ou moins
+    //  无显示地重放并返回最终状态的哈希
+    //  如果引擎请求的决策比回放中的多或少, 抛出异常
+    std::uint64_t run() const;
+};
+
+// Fournisseur qui transmet les décisions d'un autre fournisseur et les ajoute au rejeu
+//  转发另一个提供者的决策并将其加入回放的提供者
+class RecordingDecisionProvider : public DecisionProvider
+{
+private:
+    std::shared_ptr<DecisionProvider> inner;
+    std::shared_ptr<Replay> replay;
+
+    CardId record(CardId card);
+    int record(int index);
+
+public:
+    RecordingDecisionProvider(std::shared_ptr<DecisionProvider> inner, std::shared_ptr<Replay> replay)
+        : inner(std::move(inner)), replay(std::move(replay)) {}
+
+    // Fournisseur enveloppé et rejeu alimenté (Game::reset retire l'enregistreur)
+    //  被包装的提供者和写入的回放(Game::reset 移除记录器)
+    const std::shared_ptr<DecisionProvider> &getInner() const { return inner; }
+    const std::shared_ptr<Replay> &getReplay() const { return replay; }
+
+    void reset() override { inner->reset(); }
+    CardId chooseAction(const Player &player, const Game &game) override;
+    CardId chooseBuy(const Player &player, const Game &game) override;
+    CardId chooseGain(const Player &player, const Game &game, int maxCost) override;
+    int chooseDiscard(const Player &player, const Game &game) override;
+    std::vector<int> chooseCellarDiscards(const Player &player, const Game &game) override;
+    int chooseTrash(const Player &player, const Game &game) override;
+    int chooseThiefTreasure(const Player &player, const Game &game, const Player &victim,
+                            const std::vector<CardId> &treasures) override;
+};
+
+// Fournisseur qui relit les décisions d'un rejeu ; tous les joueurs partagent la même position de lecture
+//  读取回放中决策的提供者; 所有玩家共享同一个读取位置
+class ReplayDecisionProvider : public DecisionProvider
+{
+public:
+    // Position de lecture commune
+    //  共用的读取位置
+    struct Cursor
+    {
+        const std::vector<std::int32_t> &decisions;
+        std::size_t next = 0;
+
+        explicit Cursor(const std::vector<std::int32_t> &decisions) : decisions(decisions) {}
+        std::int32_t read();
+        // Décision suivante lue comme une carte, exception si ce n'est ni une carte connue ni CardIds::INVALID
+        //  将下一个决策读取为卡片, 既不是已知卡片也不是 CardIds::INVALID 时抛出异常
+        CardId readCard();
+    };
+
+    explicit ReplayDecisionProvider(std::shared_ptr<Cursor> cursor) : cursor(std::move(cursor)) {}
+
+    CardId chooseAction(const Player &player, const Game &game) override;
+    CardId chooseBuy(const Player &player, const Game &game) override;
+    CardId chooseGain(const Player &player, const Game &game, int maxCost) override;
+    int chooseDiscard(const Player &player, const Game &game) override;
+    std::vector<int> chooseCellarDiscards(const Player &player, const Game &game) override;
+    int chooseTrash(const Player &player, const Game &game) override;
+    int chooseThiefTreasure(const Player &player, const Game &game, const Player &victim,
+                            const std::vector<CardId> &treasures) override;
+
+private:
+    std::shared_ptr<Cursor> cursor;
+};
@@ -0,0 +1,94 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "Statistics.h"
+
+// Paramètres d'une série de parties entre bots
+//  一批机器人对局的参数
+struct SimulationConfig
+{
+    // Cartes du royaume (10 noms)
+    //  王国卡(10个名称)
+    std::vector<std::string> kingdomCards;
+    // Stratégie de chaque joueur (voir BotStrategies::names)
+    //  每个玩家的策略(见 BotStrategies::names)
+    std::vector<std::string> strategies;
+    // Nombre de parties et de threads de travail (0 : tous les cœurs)
+    //  对局数量和工作线程数量(0: 使用所有核心)
+    long long games = 1000;
+    int threads = 0;
+    // Limite de tours par partie, au-delà la partie est comptée comme inachevée
+    //  每局的回合上限, 超过则视为未完成
+    int maxTurns = 100;
+    // Graine de la série : la partie i utilise la graine seed + i (indépendant du nombre de threads)
+    //  这批对局的种子: 第 i 局使用种子 seed + i(与线程数量无关)
+    std::uint64_t seed = 0;
+};
+
+// Résultats agrégés d'une stratégie (indexés comme SimulationConfig::strategies)
+//  单个策略的汇总结果(索引与 SimulationConfig::strategies 相同)
+struct StrategyResult
+{
+    std::string name;
+    // Victoires (une égalité à k joueurs compte 1/k)
+    //  胜场(k名玩家平局时各计 1/k)
+    double wins = 0;
+    long long totalVictoryPoints = 0;
+    // Distribution des points de victoire : points -> nombre de parties
+    //  胜利点数分布: 点数 -> 对局数量
+    std::map<int, long long> victoryPointsHistogram;
+};
+
+// Résultats agrégés d'une série de parties
+//  一批对局的汇总结果
+struct SimulationResult
+{
+    long long games = 0;
+    long long unfinishedGames = 0;
+    long long totalTurns = 0;
+    double seconds = 0;
+    std::vector<StrategyResult> strategies;
+    // Taux de victoire par carte, points par tour (groupes : stratégies) et tours d'achat
+    //  按卡片的胜率、按回合的点数(分组: 策略)和购买回合
+    GameStatistics statistics;
+
+    // Fusionner les résultats d'un autre lot (mêmes stratégies)
+    //  合并另一批的结果(策略相同)
+    void merge(const SimulationResult &other);
+};
+
+// Résultat du test de charge
+//  压力测试的结果
+struct StressResult
+{
+    long long games = 0;
+    // Parties dont l'empreinte finale diffère de la même partie jouée seule
+    //  最终哈希与单独进行的同一局不同的对局数
+    long long mismatches = 0;
+    // Copies (fork) dont l'empreinte diffère de l'original
+    //  哈希与原局不同的副本(fork)数
+    long long forkMismatches = 0;
+    double seconds = 0;
+};
+
+// Exécution de nombreuses parties entre bots sur un pool de threads
+// Chaque thread joue ses propres instances de Game et accumule ses résultats localement
+//  在线程池上运行大量机器人对局
+//  每个线程使用自己的 Game 实例, 并在本地累计结果
+class Simulation
+{
+public:
+    // Lancer la série et renvoyer les résultats agrégés, exception si la configuration est invalide
+    //  运行这批对局并返回汇总结果, 配置无效时抛出异常
+    static SimulationResult run(const SimulationConfig &config);
+    // Test de charge de la réentrance : toutes les parties ouvertes en même temps sur plusieurs threads,
+    // chacune doit finir comme la même partie jouée seule (à lancer aussi sous ThreadSanitizer : make tsan)
+    //  可重入性压力测试: 所有对局同时在多个线程上进行,
+    //  每局的结果必须与单独进行的同一局相同(也可在 ThreadSanitizer 下运行: make tsan)
+    static StressResult stress(const SimulationConfig &config);
+    // Afficher taux de victoire, nombre moyen de tours et distribution des points
+    //  显示胜率、平均回合数和点数分布
+    static void printReport(const SimulationResult &result);
+};
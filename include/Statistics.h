@@ -0,0 +1,79 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "CardDefinitions.h"
+
+using json = nlohmann::json;
+
+class Game; // déclaration avant 向前声明
+
+// Statistiques agrégées sur de nombreuses parties : taux de victoire par carte,
+// points de victoire moyens par tour (par stratégie) et histogrammes du tour d'achat de chaque carte
+// Compteurs plats indexés par carte et par tour : chaque thread accumule les siens, puis merge les additionne
+//  多局对局的汇总统计: 按卡片的胜率、按回合的平均胜利点数(按策略), 以及每张卡片购买回合的直方图
+//  按卡片和回合索引的扁平计数器: 每个线程各自累计, 然后由 merge 相加
+class GameStatistics
+{
+public:
+    // Compteurs d'une carte
+    //  单张卡片的计数器
+    struct CardCounters
+    {
+        // Joueurs (une partie, un siège) ayant acheté ou obtenu la carte, et leurs victoires
+        // (une égalité à k joueurs compte 1/k)
+        //  购买或获得该卡的玩家(一局中的一个座位)及其胜场(k名玩家平局时各计 1/k)
+        long long acquiredBy = 0;
+        double wins = 0;
+        // Achats par tour : buyTurns[t] = nombre d'achats au tour t
+        //  按回合的购买数: buyTurns[t] = 第 t 回合的购买次数
+        std::vector<long long> buyTurns;
+    };
+
+    // Groupes de sièges (les stratégies d'une simulation) pour les points par tour ; un nom qui revient
+    // plusieurs fois reçoit son rang dans la liste ("bigmoney#1", "bigmoney#2") pour que chaque groupe ait sa clé
+    //  用于按回合点数的座位分组(模拟中的策略); 重复出现的名称加上其在列表中的序号
+    //  ("bigmoney#1", "bigmoney#2"), 使每个组都有自己的键
+    explicit GameStatistics(std::vector<std::string> groupNames = {});
+
+    // Après chaque tour complet : points de victoire de chaque siège, rangés dans le groupe seatGroup[siège]
+    //  每个完整回合之后: 每个座位的胜利点数, 归入 seatGroup[座位] 组
+    void recordRound(const Game &game, const std::vector<std::size_t> &seatGroup);
+    // Partie terminée : cartes achetées ou obtenues (journal de la partie) et part de victoire de chaque siège
+    //  对局结束: 购买或获得的卡片(对局日志)以及每个座位的胜场份额
+    void recordGame(const Game &game, const std::vector<double> &seatWins);
+    // Additionner les compteurs d'un autre accumulateur (mêmes groupes)
+    //  累加另一个累计器的计数器(分组相同)
+    void merge(const GameStatistics &other);
+
+    long long getGames() const { return games; }
+    const CardCounters &getCard(CardId card) const { return cards[card]; }
+    // Points de victoire moyens du groupe au tour turn (0 si aucun échantillon)
+    //  该组在第 turn 回合的平均胜利点数(没有样本时为 0)
+    double averageVictoryPoints(std::size_t group, int turn) const;
+
+    // Format long : mesure,nom,tour,echantillons,valeur (une ligne par carte ou par tour)
+    //  长格式: 度量,名称,回合,样本数,数值(每张卡片或每个回合一行)
+    void writeCsv(std::ostream &out) const;
+    json toJson() const;
+    // Format choisi par l'extension : JSON pour .json, CSV sinon ; exception si le fichier ne peut pas être créé
+    //  根据扩展名选择格式: .json 为 JSON, 否则为 CSV; 无法创建文件时抛出异常
+    void save(const std::string &filename) const;
+
+private:
+    // Sommes et échantillons des points d'un groupe, indexés par tour
+    //  一个组的点数总和与样本数, 按回合索引
+    struct VictoryPointsByTurn
+    {
+        std::vector<long long> sum;
+        std::vector<long long> samples;
+    };
+
+    std::vector<std::string> groupNames;
+    long long games = 0;
+    std::array<CardCounters, CardIds::COUNT> cards;
+    std::vector<VictoryPointsByTurn> victoryPoints;
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include "Card.h"
+
+class BinaryWriter;
+class BinaryReader;
+
+// Réserve : nombre de cartes restantes par pile, indexé par identifiant de carte
+// Achat, gain et décompte des piles vides en temps constant, sans allocation
+//  供应堆: 按卡片标识索引的每堆剩余数量
+//  购买、获得和空堆计数均为常数时间, 无内存分配
+class Supply
+{
+private:
+    // Nombre de cartes restantes de chaque pile
+    //  每堆剩余的卡片数量
+    std::array<int, CardIds::COUNT> counts;
+    // Masque des piles présentes dans la partie (bit = identifiant de carte)
+    //  本局游戏中存在的供应堆掩码(位 = 卡片标识)
+    std::uint32_t piles;
+    // Nombre de piles présentes et vides
+    //  存在且为空的供应堆数量
+    int emptyPiles;
+
+    static_assert(CardIds::COUNT <= 32, "Supply::piles ne peut contenir que 32 piles");
+
+public:
+    Supply() { clear(); }
+
+    // Retirer toutes les piles
+    //  移除所有供应堆
+    void clear();
+    // Ajouter (ou remplacer) une pile de count cartes
+    //  添加(或替换)一个有 count 张牌的供应堆
+    void setPile(CardId card, int count);
+    // Retirer une carte de la pile, renvoie false si la pile est absente ou vide
+    //  从供应堆取出一张牌, 供应堆不存在或为空时返回 false
+    bool take(CardId card);
+
+    // Requête d'état
+    //  状态查询
+    bool contains(CardId card) const { return card < CardIds::COUNT && (piles >> card & 1u); }
+    int count(CardId card) const { return contains(card) ? counts[card] : 0; }
+    bool isEmpty(CardId card) const { return count(card) == 0; }
+    int getEmptyPiles() const { return emptyPiles; }
+
+    // Sauvegarde binaire : masque des piles puis nombre de cartes de chaque pile présente
+    //  二进制存档: 供应堆掩码, 然后是每个存在的供应堆的卡片数量
+    void toBinary(BinaryWriter &out) const;
+    void fromBinary(BinaryReader &in);
+};
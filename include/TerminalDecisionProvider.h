@@ -0,0 +1,17 @@
+#pragma once
+#include "DecisionProvider.h"
+
+// Décisions saisies au terminal (std::cin) -comportement interactif d'origine
+//  终端输入的决策(std::cin) - 原有的交互行为
+class TerminalDecisionProvider : public DecisionProvider
+{
+public:
+    CardId chooseAction(const Player &player, const Game &game) override;
+    CardId chooseBuy(const Player &player, const Game &game) override;
+    CardId chooseGain(const Player &player, const Game &game, int maxCost) override;
+    int chooseDiscard(const Player &player, const Game &game) override;
+    std::vector<int> chooseCellarDiscards(const Player &player, const Game &game) override;
+    int chooseTrash(const Player &player, const Game &game) override;
+    int chooseThiefTreasure(const Player &player, const Game &game, const Player &victim,
+                            const std::vector<CardId> &treasures) override;
+};
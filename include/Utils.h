@@ -2,7 +2,7 @@
 #include <string>
 #include <vector>
 #include <algorithm>
-#include <random>
+#include "Random.h"
 #include <iostream>
 #include <sstream>
 
@@ -38,31 +38,23 @@ public:
 
     // Ignore la casse et compare deux chaînes pour voir si elles sont égales.
     //  忽略大小写比较两个字符串是否相等
+    // Comparaison caractère par caractère, sans copie en minuscules
+    //  逐字符比较, 不创建小写副本
     static bool equalIgnoreCase(const std::string &str1, const std::string &str2)
     {
-        return toLower(str1) == toLower(str2);
+        return str1.size() == str2.size() &&
+               std::equal(str1.begin(), str1.end(), str2.begin(),
+                          [](char a, char b)
+                          { return ::tolower(static_cast<unsigned char>(a)) == ::tolower(static_cast<unsigned char>(b)); });
     }
 
     // Génération de nombres aléatoires
+    // Le générateur est fourni par l'appelant (celui de la partie), pour que le tirage soit reproductible
     //  随机数生成
-    static int getRandomNumber(int min, int max)
+    //  生成器由调用者提供(对局的生成器), 以保证结果可重现
+    static int getRandomNumber(Random &rng, int min, int max)
     {
-        // Périphérique aléatoire, utilisé pour générer des graines aléatoires (un générateur matériel de nombres aléatoires (si le matériel le prend en charge), sinon il dégénérera en génération de nombres pseudo-aléatoires)
-        // static garantit qu'il n'est initialisé qu'une seule fois pendant toute l'exécution du programme pour éviter la surcharge liée à la création d'objets plusieurs fois. -Même si getRandomNumber est appelé plusieurs fois, il réutilisera la même instance
-        //  随机设备，用于生成随机种子(一个硬件随机数生成器（如果硬件支持），否则会退化为伪随机数生成)
-        // static 确保在整个程序运行期间只初始化一次，避免多次创建对象的开销。 - 即使多次调用 getRandomNumber，它也会复用同一个 rd 实例
-        static std::random_device rd;
-
-        // Générateur d'algorithme de rotation de Mersenne -efficace et aléatoire
-        // static garantit qu'il n'est initialisé qu'une seule fois pendant toute l'exécution du programme pour éviter la surcharge liée à la création d'objets plusieurs fois.
-        //  梅森旋转算法生成器 - 效率高且随机性良好
-        // static 确保在整个程序运行期间只初始化一次，避免多次创建对象的开销。
-        static std::mt19937 gen(rd());
-
-        // dis est une variable locale, qui sera recréée à chaque appel de la fonction, afin que la plage de génération de nombres aléatoires puisse être ajustée de manière flexible.
-        //  dis 是局部变量，每次调用函数时都会重新创建，这样可以灵活调整随机数生成范围
-        std::uniform_int_distribution<> dis(min, max);
-        return dis(gen);
+        return rng.between(min, max);
     }
 
     // Divise la chaîne selon le délimiteur spécifié et renvoie la liste des chaînes divisées
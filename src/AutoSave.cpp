@@ -0,0 +1,98 @@
+#include "AutoSave.h"
+#include "Game.h"
+#include <filesystem>
+
+AutoSaver::AutoSaver(std::string filename)
+    : filename(std::move(filename)), worker(&AutoSaver::run, this)
+{
+}
+
+AutoSaver::~AutoSaver()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    worker.join();
+}
+
+void AutoSaver::submit(std::unique_ptr<Game> snapshot)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = std::move(snapshot);
+    }
+    wake.notify_one();
+}
+
+void AutoSaver::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this]
+              { return !pending && !writing; });
+}
+
+std::string AutoSaver::takeError()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::string result;
+    result.swap(error);
+    return result;
+}
+
+// Boucle du thread d'écriture : prendre l'instantané en attente, l'écrire hors du verrou
+// À l'arrêt, l'instantané en attente est encore écrit
+//  写入线程的循环: 取出等待中的快照, 在锁外写入
+//  停止时, 仍会写入等待中的快照
+void AutoSaver::run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        wake.wait(lock, [this]
+                  { return pending || stopping; });
+        if (!pending)
+        {
+            return;
+        }
+        std::unique_ptr<Game> snapshot = std::move(pending);
+        writing = true;
+        lock.unlock();
+
+        std::string failure;
+        try
+        {
+            write(*snapshot);
+        }
+        catch (const std::exception &e)
+        {
+            failure = e.what();
+        }
+        snapshot.reset();
+
+        lock.lock();
+        writing = false;
+        if (!failure.empty())
+        {
+            error = failure;
+        }
+        if (!pending)
+        {
+            idle.notify_all();
+        }
+    }
+}
+
+// Écrire dans "<nom>.tmp<extension>" (même format que la destination), puis renommer :
+// le renommage remplace le fichier d'un seul coup
+//  写入 "<名称>.tmp<扩展名>"(格式与目标相同), 然后重命名: 重命名一次性替换文件
+void AutoSaver::write(Game &snapshot)
+{
+    std::filesystem::path target = filename;
+    std::filesystem::path temporary = target;
+    temporary.replace_filename(target.stem().string() + ".tmp" + target.extension().string());
+
+    snapshot.saveGame(temporary.string());
+    std::filesystem::rename(temporary, target);
+}
@@ -2,22 +2,15 @@
 #include "Player.h"
 #include "Game.h"
 
-// Fonction : Augmenter les pièces d'or du joueur
-//  作用: 增加玩家金币
-
-void Copper::play(Player &player, Game &game)
-{
-    player.addCoin(1); // Ajouter 1 pièce d'or
-                       //  增加1金币
-}
-
-void Silver::play(Player &player, Game &game)
+// Fonction : Appliquer les bonus de la définition, et journaliser les cartes action
+// Les trésors joués ne sont pas journalisés (phase trésor, voir Player::playAllTreasures)
+//  作用: 结算定义中的奖励, 并记录行动卡
+//  使用的财宝卡不记录日志(财宝阶段, 见 Player::playAllTreasures)
+void VanillaCard::play(Player &player, Game &game) const
 {
-    player.addCoin(2); // Ajouter 2 pièces d'or
-                       //  增加2金币
+    applyBonuses(player);
+    if (type == CardType::ACTION)
+    {
+        game.logEvent(GameEventKind::CARD_PLAYED, player, id);
+    }
 }
-
-void Gold::play(Player &player, Game &game)
-{
-    player.addCoin(3);
-}
\ No newline at end of file
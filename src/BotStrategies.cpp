@@ -0,0 +1,329 @@
+#include "BotStrategies.h"
+#include "MctsStrategy.h"
+#include "Player.h"
+#include "Game.h"
+#include "Utils.h"
+#include <algorithm>
+#include <stdexcept>
+
+// Valeur d'une carte pour le joueur : plus elle est faible, plus la carte est défaussée tôt
+//  卡片对玩家的价值: 越低越先被弃掉
+static int keepValue(CardId card)
+{
+    if (card == CardIds::CURSE)
+    {
+        return 0;
+    }
+    const Card &c = Card::get(card);
+    switch (c.getType())
+    {
+    case CardType::VICTORY:
+        return 1;
+    case CardType::TREASURE:
+        return 10 + c.getCost();
+    default:
+        return 20 + c.getCost();
+    }
+}
+
+// Index de la carte de la main la moins utile
+//  手牌中最没用的卡的索引
+static int leastValuableIndex(const Hand &hand)
+{
+    int best = 0;
+    for (size_t i = 1; i < hand.size(); i++)
+    {
+        if (keepValue(hand[i]) < keepValue(hand[best]))
+        {
+            best = static_cast<int>(i);
+        }
+    }
+    return best;
+}
+
+// Nombre d'exemplaires de la carte possédés (pioche, main, défausse, en jeu)
+//  拥有的该卡数量(牌堆、手牌、弃牌堆、场上)
+int BotStrategy::countOwned(const Player &player, CardId card)
+{
+    return player.getOwnedCount(card);
+}
+
+// Carte disponible dans la réserve
+//  供应堆中可获得该卡
+static bool available(const Game &game, CardId card)
+{
+    return game.getSupplyCount(card) > 0;
+}
+
+// Fin de partie commune : Province à 8 ; Duché à 5 quand il reste 4 Provinces ou moins ; Manoir à 2 quand il en reste 2 ou moins
+//  共用的终局规则: 8金买行省; 行省剩4张及以下时5金买公爵领地; 剩2张及以下时2金买庄园
+CardId BotStrategy::pickVictory(const Game &game, int coins)
+{
+    int provincesLeft = game.getSupplyCount(CardIds::PROVINCE);
+
+    if (coins >= 8 && provincesLeft > 0)
+        return CardIds::PROVINCE;
+    if (coins >= 5 && provincesLeft <= 4 && available(game, CardIds::DUCHY))
+        return CardIds::DUCHY;
+    if (coins >= 2 && coins < 6 && provincesLeft <= 2 && available(game, CardIds::ESTATE))
+        return CardIds::ESTATE;
+    return CardIds::INVALID;
+}
+
+// Or à 6, Argent à 3
+//  6金买金币, 3金买银币
+CardId BotStrategy::pickTreasure(const Game &game, int coins)
+{
+    if (coins >= 6 && available(game, CardIds::GOLD))
+        return CardIds::GOLD;
+    if (coins >= 3 && available(game, CardIds::SILVER))
+        return CardIds::SILVER;
+    return CardIds::INVALID;
+}
+
+// Cartes action dans l'ordre où les jouer : d'abord celles qui rendent des actions, puis les terminales
+//  行动卡的使用顺序: 先用返还行动点的卡, 再用终端卡
+const std::vector<CardId> &BotStrategy::actionPriority() const
+{
+    static const std::vector<CardId> priority = {
+        CardIds::VILLAGE, CardIds::LABORATORY, CardIds::MARKET, CardIds::CELLAR,
+        CardIds::WITCH, CardIds::COUNCIL_ROOM, CardIds::SMITHY, CardIds::MILITIA,
+        CardIds::MONEYLENDER, CardIds::WOODCUTTER, CardIds::WORKSHOP, CardIds::FEAST,
+        CardIds::THIEF, CardIds::MOAT, CardIds::CHAPEL};
+    return priority;
+}
+
+// Jouer la première carte de la liste de priorité présente en main
+//  使用优先级列表中第一张在手牌中的卡
+CardId BotStrategy::chooseAction(const Player &player, const Game &)
+{
+    const auto &hand = player.getHand();
+    for (CardId card : actionPriority())
+    {
+        if (hand.contains(card))
+        {
+            return card;
+        }
+    }
+    return CardIds::INVALID;
+}
+
+CardId BotStrategy::chooseBuy(const Player &player, const Game &game)
+{
+    return pickCard(player, game, player.getCoins());
+}
+
+// Atelier / Festin : même règle que l'achat, avec maxCost pièces
+//  工场 / 盛宴: 与购买规则相同, 以 maxCost 金币计算
+CardId BotStrategy::chooseGain(const Player &player, const Game &game, int maxCost)
+{
+    return pickCard(player, game, maxCost);
+}
+
+int BotStrategy::chooseDiscard(const Player &player, const Game &)
+{
+    return leastValuableIndex(player.getHand());
+}
+
+// Cave : défausser les cartes Victoire et Malédiction
+//  地窖: 弃掉胜利点数卡和诅咒卡
+std::vector<int> BotStrategy::chooseCellarDiscards(const Player &player, const Game &)
+{
+    std::vector<int> choices;
+    const auto &hand = player.getHand();
+    for (size_t i = 0; i < hand.size(); i++)
+    {
+        if (keepValue(hand[i]) < 10)
+        {
+            choices.push_back(static_cast<int>(i));
+        }
+    }
+    return choices;
+}
+
+// Chapelle : écarter les Malédictions seulement
+//  教堂: 只废除诅咒卡
+int BotStrategy::chooseTrash(const Player &player, const Game &)
+{
+    const auto &hand = player.getHand();
+    for (size_t i = 0; i < hand.size(); i++)
+    {
+        if (hand[i] == CardIds::CURSE)
+        {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+// Voleur : prendre le trésor le plus cher
+//  窃贼: 拿走最贵的财宝
+int BotStrategy::chooseThiefTreasure(const Player &, const Game &, const Player &,
+                                     const std::vector<CardId> &treasures)
+{
+    if (treasures.empty())
+    {
+        return -1;
+    }
+    int best = 0;
+    for (size_t i = 1; i < treasures.size(); i++)
+    {
+        if (Card::get(treasures[i]).getCost() > Card::get(treasures[best]).getCost())
+        {
+            best = static_cast<int>(i);
+        }
+    }
+    return best;
+}
+
+// Big Money : ne joue aucune action
+//  大钱: 不使用任何行动卡
+const std::vector<CardId> &BigMoneyStrategy::actionPriority() const
+{
+    static const std::vector<CardId> none;
+    return none;
+}
+
+// Province à 8, Or à 6-7, Argent à 3-5 ; Duché puis Manoir quand les Provinces s'épuisent
+//  8金买行省, 6-7金买金币, 3-5金买银币; 行省将尽时买公爵领地和庄园
+CardId BigMoneyStrategy::pickCard(const Player &, const Game &game, int coins) const
+{
+    CardId victory = pickVictory(game, coins);
+    return victory != CardIds::INVALID ? victory : pickTreasure(game, coins);
+}
+
+// Forge à 4-5 tant qu'il y a moins d'une Forge pour 12 cartes, sinon Big Money
+//  4-5金时, 若每12张牌不足一张铁匠则买铁匠, 否则按大钱策略
+CardId SmithyBigMoneyStrategy::pickCard(const Player &player, const Game &game, int coins) const
+{
+    CardId victory = pickVictory(game, coins);
+    if (victory != CardIds::INVALID)
+        return victory;
+    if (coins >= 4 && coins <= 5 && available(game, CardIds::SMITHY) &&
+        countOwned(player, CardIds::SMITHY) * 12 < player.getCardCount())
+        return CardIds::SMITHY;
+    return pickTreasure(game, coins);
+}
+
+// Sorcière à 5 tant qu'on en a moins de deux, sinon Big Money
+//  5金时若女巫少于两张则买女巫, 否则按大钱策略
+CardId WitchRushStrategy::pickCard(const Player &player, const Game &game, int coins) const
+{
+    CardId victory = pickVictory(game, coins);
+    if (victory != CardIds::INVALID)
+        return victory;
+    if (coins >= 5 && available(game, CardIds::WITCH) && countOwned(player, CardIds::WITCH) < 2)
+        return CardIds::WITCH;
+    return pickTreasure(game, coins);
+}
+
+// Chapelle aux deux premiers tours ; à 5 une Sorcière puis Laboratoires/Marchés ;
+// Forge si les Villages suffisent, sinon Village ; Or et Argent pour compléter
+//  前两回合买教堂; 5金先买一张女巫, 然后实验室/市场;
+//  村庄足够时买铁匠, 否则买村庄; 其余买金币和银币
+CardId EngineStrategy::pickCard(const Player &player, const Game &game, int coins) const
+{
+    CardId victory = pickVictory(game, coins);
+    if (victory != CardIds::INVALID)
+        return victory;
+
+    if (coins <= 4 && game.getTurnCount() <= 2 && available(game, CardIds::CHAPEL) &&
+        countOwned(player, CardIds::CHAPEL) == 0)
+        return CardIds::CHAPEL;
+
+    if (coins >= 5)
+    {
+        if (available(game, CardIds::WITCH) && countOwned(player, CardIds::WITCH) == 0)
+            return CardIds::WITCH;
+        if (coins < 6 || countOwned(player, CardIds::GOLD) > 0)
+        {
+            for (CardId card : {CardIds::LABORATORY, CardIds::MARKET})
+            {
+                if (available(game, card))
+                    return card;
+            }
+        }
+    }
+    if (coins >= 6 && available(game, CardIds::GOLD))
+        return CardIds::GOLD;
+
+    int villages = countOwned(player, CardIds::VILLAGE);
+    int terminals = countOwned(player, CardIds::SMITHY) + countOwned(player, CardIds::WITCH) +
+                    countOwned(player, CardIds::MILITIA) + countOwned(player, CardIds::COUNCIL_ROOM);
+    if (coins >= 4 && terminals <= villages)
+    {
+        for (CardId card : {CardIds::SMITHY, CardIds::MILITIA})
+        {
+            if (available(game, card))
+                return card;
+        }
+    }
+    if (coins >= 3 && villages < terminals && available(game, CardIds::VILLAGE))
+        return CardIds::VILLAGE;
+
+    return pickTreasure(game, coins);
+}
+
+// Chapelle : Malédictions, Manoirs tant que la fin est loin, Cuivres tant qu'il reste 6 pièces d'autres trésors
+//  教堂: 诅咒卡; 终局尚远时的庄园; 其他财宝仍有6金时的铜币
+int EngineStrategy::chooseTrash(const Player &player, const Game &game)
+{
+    int curse = BotStrategy::chooseTrash(player, game);
+    if (curse >= 0)
+        return curse;
+
+    const auto &hand = player.getHand();
+    if (game.getSupplyCount(CardIds::PROVINCE) > 4)
+    {
+        auto it = std::find(hand.begin(), hand.end(), CardIds::ESTATE);
+        if (it != hand.end())
+            return static_cast<int>(it - hand.begin());
+    }
+
+    int otherMoney = 2 * countOwned(player, CardIds::SILVER) + 3 * countOwned(player, CardIds::GOLD) +
+                     countOwned(player, CardIds::MARKET);
+    if (otherMoney >= 6)
+    {
+        auto it = std::find(hand.begin(), hand.end(), CardIds::COPPER);
+        if (it != hand.end())
+            return static_cast<int>(it - hand.begin());
+    }
+    return -1;
+}
+
+// Créer la stratégie nommée (insensible à la casse), exception si inconnue
+//  创建指定名称的策略(不区分大小写), 未知时抛出异常
+std::shared_ptr<DecisionProvider> BotStrategies::create(const std::string &name)
+{
+    if (Utils::equalIgnoreCase(name, "bigmoney"))
+    {
+        return std::make_shared<BigMoneyStrategy>();
+    }
+    if (Utils::equalIgnoreCase(name, "smithy"))
+    {
+        return std::make_shared<SmithyBigMoneyStrategy>();
+    }
+    if (Utils::equalIgnoreCase(name, "witch"))
+    {
+        return std::make_shared<WitchRushStrategy>();
+    }
+    if (Utils::equalIgnoreCase(name, "engine"))
+    {
+        return std::make_shared<EngineStrategy>();
+    }
+    // Joueur Monte Carlo, budget optionnel : "mcts:500", "mcts:20ms", "mcts:20ms/4"
+    //  蒙特卡洛玩家, 可选预算: "mcts:500", "mcts:20ms", "mcts:20ms/4"
+    if (Utils::toLower(name).compare(0, 4, "mcts") == 0)
+    {
+        return std::make_shared<MctsStrategy>(MctsConfig::fromSpec(Utils::toLower(name)));
+    }
+    throw std::runtime_error("Stratégie inconnue: " + name); // 未知策略
+}
+
+// Noms des stratégies disponibles
+//  可用策略的名称
+const std::vector<std::string> &BotStrategies::names()
+{
+    static const std::vector<std::string> strategyNames = {"bigmoney", "smithy", "witch", "engine", "mcts"};
+    return strategyNames;
+}
@@ -1,10 +1,13 @@
 #include "Card.h"
 #include "AllCards.h"
 #include <stdexcept>
+#include <array>
+#include <string_view>
+#include <cstdint>
 
-// Charger les noms de cartes depuis JSON et créer des cartes
-//  从 JSON 加载卡牌名称并创建卡牌
-std::shared_ptr<Card> Card::fromJson(const json &j)
+// Charger le nom de carte depuis JSON et récupérer son identifiant
+//  从 JSON 加载卡牌名称并获取其标识
+CardId Card::fromJson(const json &j)
 {
     try
     {
@@ -23,9 +26,9 @@ std::shared_ptr<Card> Card::fromJson(const json &j)
         {
             throw std::runtime_error("Invalid card format in JSON");
         }
-        // Créer une carte
-        //  创建卡牌
-        return createCard(cardName);
+        // Rechercher la carte
+        //  查找卡牌
+        return idOf(cardName);
     }
     catch (const std::exception &e)
     {
@@ -33,84 +36,207 @@ std::shared_ptr<Card> Card::fromJson(const json &j)
     }
 }
 
+// Fabriques des cartes, indexées par identifiant, générées à la compilation
+// Cartes vanilla : VanillaCard ; autres cartes : leur classe, placée à l'index T::ID
+//  卡牌工厂, 按标识索引, 在编译时生成
+//  vanilla 卡: VanillaCard; 其他卡: 各自的类, 放在 T::ID 索引处
+using CardFactory = std::shared_ptr<Card> (*)(CardId);
+
+static std::shared_ptr<Card> makeVanillaCard(CardId id)
+{
+    return std::make_shared<VanillaCard>(id);
+}
+
+template <typename T>
+static std::shared_ptr<Card> makeCard(CardId)
+{
+    static_assert(!CARD_DEFINITIONS[T::ID].vanilla, "une carte vanilla n'a pas de classe propre");
+    return std::make_shared<T>();
+}
+
+template <typename... Special>
+static constexpr std::array<CardFactory, CardIds::COUNT> cardFactories()
+{
+    std::array<CardFactory, CardIds::COUNT> factories{};
+    for (std::size_t id = 0; id < CardIds::COUNT; id++)
+    {
+        if (CARD_DEFINITIONS[id].vanilla)
+            factories[id] = &makeVanillaCard;
+    }
+    ((factories[Special::ID] = &makeCard<Special>), ...);
+    return factories;
+}
+
+static constexpr std::array<CardFactory, CardIds::COUNT> CARD_FACTORIES =
+    cardFactories<Militia, CouncilRoom, Moneylender, Workshop, Cellar, Witch, Thief, Chapel, Feast>();
+
+// Vérifier à la compilation que chaque carte a une fabrique
+//  编译时检查每张卡都有工厂
+static constexpr bool everyCardHasFactory()
+{
+    for (CardFactory factory : CARD_FACTORIES)
+    {
+        if (factory == nullptr)
+            return false;
+    }
+    return true;
+}
+static_assert(everyCardHasFactory(), "carte non vanilla sans classe dans CARD_FACTORIES");
+
+// Table des prototypes : une seule instance immuable par type de carte, créée au premier accès
+//  原型表: 每种卡牌只有一个不可变实例, 首次访问时创建
+static const std::array<std::shared_ptr<const Card>, CardIds::COUNT> &prototypes()
+{
+    static const std::array<std::shared_ptr<const Card>, CardIds::COUNT> table = []
+    {
+        std::array<std::shared_ptr<const Card>, CardIds::COUNT> result;
+        for (CardId id = 0; id < CardIds::COUNT; id++)
+        {
+            result[id] = CARD_FACTORIES[id](id);
+        }
+        return result;
+    }();
+    return table;
+}
+
+// Minuscule ASCII, utilisable à la compilation
+//  ASCII 小写, 可在编译时使用
+static constexpr char lowerAscii(char c)
+{
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+// Compare deux noms de carte sans tenir compte de la casse ni des espaces ("Council Room" == "councilroom")
+//  比较两个卡牌名称, 忽略大小写和空格("Council Room" == "councilroom")
+static constexpr bool sameCardName(std::string_view a, std::string_view b)
+{
+    size_t i = 0, j = 0;
+    while (true)
+    {
+        while (i < a.size() && a[i] == ' ')
+            i++;
+        while (j < b.size() && b[j] == ' ')
+            j++;
+        if (i == a.size() || j == b.size())
+            return i == a.size() && j == b.size();
+        if (lowerAscii(a[i]) != lowerAscii(b[j]))
+            return false;
+        i++;
+        j++;
+    }
+}
+
+// Récupère le prototype partagé de la carte
+//  获取卡牌的共享原型
+const Card &Card::get(CardId id)
+{
+    return *prototypes()[id];
+}
+
+// Hachage FNV-1a d'un nom de carte, sans tenir compte de la casse ni des espaces
+//  卡牌名称的 FNV-1a 哈希, 忽略大小写和空格
+static constexpr std::uint32_t hashCardName(std::string_view name)
+{
+    std::uint32_t hash = 2166136261u;
+    for (char c : name)
+    {
+        if (c == ' ')
+            continue;
+        hash ^= static_cast<std::uint32_t>(static_cast<unsigned char>(lowerAscii(c)));
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Taille de la table de recherche par nom (puissance de 2, au moins 2 fois le nombre de noms)
+//  按名称查找表的大小(2的幂, 至少为名称数量的2倍)
+static constexpr std::size_t NAME_TABLE_SIZE = 128;
+static_assert(NAME_TABLE_SIZE >= 4 * CardIds::COUNT, "table de noms trop petite");
+
+// Table de recherche nom -> identifiant (adressage ouvert), construite à la compilation
+// Contient le nom d'usine et le nom affiché de chaque carte
+//  名称 -> 标识查找表(开放寻址), 在编译时构建
+//  包含每张卡牌的工厂名称和显示名称
+static constexpr std::array<CardId, NAME_TABLE_SIZE> NAME_TABLE = []
+{
+    std::array<CardId, NAME_TABLE_SIZE> table{};
+    for (CardId &slot : table)
+    {
+        slot = CardIds::INVALID;
+    }
+    for (std::size_t id = 0; id < CardIds::COUNT; id++)
+    {
+        for (std::string_view name : {CARD_DEFINITIONS[id].factoryName, CARD_DEFINITIONS[id].name})
+        {
+            std::size_t slot = hashCardName(name) & (NAME_TABLE_SIZE - 1);
+            while (table[slot] != CardIds::INVALID && table[slot] != id)
+            {
+                slot = (slot + 1) & (NAME_TABLE_SIZE - 1);
+            }
+            table[slot] = static_cast<CardId>(id);
+        }
+    }
+    return table;
+}();
+
+// Identifiant d'après le nom, CardIds::INVALID si inconnu -temps constant, sans allocation
+//  根据名称获取标识, 未知时返回 CardIds::INVALID - 常数时间, 无内存分配
+CardId Card::findId(const std::string &cardName)
+{
+    std::size_t slot = hashCardName(cardName) & (NAME_TABLE_SIZE - 1);
+    while (NAME_TABLE[slot] != CardIds::INVALID)
+    {
+        const CardDefinition &definition = CARD_DEFINITIONS[NAME_TABLE[slot]];
+        if (sameCardName(cardName, definition.factoryName) || sameCardName(cardName, definition.name))
+        {
+            return definition.id;
+        }
+        slot = (slot + 1) & (NAME_TABLE_SIZE - 1);
+    }
+    return CardIds::INVALID;
+}
+
+// Identifiant d'après le nom, exception si inconnu
+//  根据名称获取标识, 未知时抛出异常
+CardId Card::idOf(const std::string &cardName)
+{
+    CardId id = findId(cardName);
+    if (id == CardIds::INVALID)
+    {
+        throw std::runtime_error("Unknown card type: " + cardName);
+    }
+    return id;
+}
+
 // Créer une carte en fonction de son nom
-// Utiliser le mode usine pour créer des cartes : créer tous types de cartes de manière centralisée
-// Pointeur : pointeur intelligent pointant vers l'objet de classe Card
+// Utiliser le mode usine pour créer des cartes : recherche du nom puis fabrique indexée par identifiant
+// Pointeur : pointeur intelligent pointant vers l'objet de classe Card
 //  根据名称创建卡牌
-//  使用工厂模式创建卡牌: 集中创建所有类型的卡牌
+//  使用工厂模式创建卡牌: 先查找名称, 再按标识调用工厂
 //  指针: 指向Card类对象的智能指针
 std::shared_ptr<Card> Card::createCard(const std::string &cardName)
 {
-    try
-    { // Essayez de créer une carte
-        // 尝试创建卡牌
-
-        // 1. Cartes au trésor de base : pièces de cuivre, pièces d'argent, pièces d'or
-        //  1.基础财宝牌：铜币、银币、金币
-        if (cardName == "Copper")
-            return std::make_shared<Copper>();
-        if (cardName == "Silver")
-            return std::make_shared<Silver>();
-        if (cardName == "Gold")
-            return std::make_shared<Gold>();
-
-        // 2. Cartes de points de victoire de base : manoir, duc, province, jardin, malédiction
-        //  2.基础胜利点数牌：庄园、公爵、省份、花园、诅咒
-        if (cardName == "Estate")
-            return std::make_shared<Estate>();
-        if (cardName == "Duchy")
-            return std::make_shared<Duchy>();
-        if (cardName == "Province")
-            return std::make_shared<Province>();
-        if (cardName == "Gardens")
-            return std::make_shared<Gardens>();
-        if (cardName == "Curse")
-            return std::make_shared<Curse>();
-
-        // 3. Cartes d'action de base : village, marché, artisan, ferme forestière, milice, maison municipale, changeur d'argent, tranchée, atelier, cave à vin, sorcière, voleur, festin, laboratoire
-        //  3.基础行动牌：村庄、市场、工匠、林场、民兵、议事厅、钱币兑换商、壕沟、工坊、酒窖、女巫、窃贼、盛宴、实验室
-        if (cardName == "Village")
-            return std::make_shared<Village>();
-        if (cardName == "Market")
-            return std::make_shared<Market>();
-        if (cardName == "Smithy")
-            return std::make_shared<Smithy>();
-        if (cardName == "Woodcutter")
-            return std::make_shared<Woodcutter>();
-        if (cardName == "Militia")
-            return std::make_shared<Militia>();
-        if (cardName == "CouncilRoom")
-            return std::make_shared<CouncilRoom>();
-        if (cardName == "Moneylender")
-            return std::make_shared<Moneylender>();
-        if (cardName == "Moat")
-            return std::make_shared<Moat>();
-        if (cardName == "Workshop")
-            return std::make_shared<Workshop>();
-        if (cardName == "Cellar")
-            return std::make_shared<Cellar>();
-        if (cardName == "Chapel")
-            return std::make_shared<Chapel>();
-        if (cardName == "Witch")
-            return std::make_shared<Witch>();
-        if (cardName == "Thief")
-            return std::make_shared<Thief>();
-        if (cardName == "Feast")
-            return std::make_shared<Feast>();
-        if (cardName == "Laboratory")
-            return std::make_shared<Laboratory>();
-
-        // 4. Autres cartes
-        //  4.其他牌
-        throw std::runtime_error("Unknown card type: " + cardName);
-    }
-
-    // Échec de la création de la carte, erreur générée
-    //  创建卡牌失败, 抛出错误
-    catch (const std::exception &e)
+    CardId id = findId(cardName);
+    if (id == CardIds::INVALID)
     {
-        throw std::runtime_error("Failed to create card: " + cardName + " - " + e.what());
+        throw std::runtime_error("Failed to create card: " + cardName + " - Unknown card type: " + cardName);
     }
+    return CARD_FACTORIES[id](id);
+}
+
+// Appliquer les bonus fixes de la définition, avec le noyau commun Player::applyEffect
+//  用共用内核 Player::applyEffect 结算定义中的固定奖励
+void Card::applyBonuses(Player &player) const
+{
+    player.applyEffect(CARD_EFFECTS[id]);
+}
+
+// Texte du journal : celui de la définition, sinon "<nom> utilisé"
+//  日志文本: 定义中的文本, 否则为 "<名称> utilisé"
+std::string Card::describePlay(int) const
+{
+    const char *text = CARD_DEFINITIONS[id].playText;
+    return text ? text : name + " utilisé";
 }
 
 // inutile
@@ -0,0 +1,63 @@
+#include "Deck.h"
+
+// Vider la pioche
+//  清空牌堆
+void Deck::clear()
+{
+    counts.fill(0);
+    total = 0;
+}
+
+// Ajouter count exemplaires d'une carte
+//  加入 count 张某卡片
+void Deck::add(CardId card, int count)
+{
+    counts[card] += static_cast<std::uint16_t>(count);
+    total += static_cast<std::uint16_t>(count);
+}
+
+// Tirage : un rang uniforme parmi les cartes restantes, puis la carte qui occupe ce rang
+//  抽取: 在剩余卡片中均匀选一个位置, 然后取该位置上的卡片
+CardId Deck::draw(Random &rng)
+{
+    if (total == 0)
+    {
+        return CardIds::INVALID;
+    }
+    std::uint32_t rank = rng.below(total);
+    CardId card = 0;
+    while (rank >= counts[card])
+    {
+        rank -= counts[card];
+        card++;
+    }
+    counts[card]--;
+    total--;
+    return card;
+}
+
+// Retirer un exemplaire d'une carte
+//  移除一张某卡片
+bool Deck::remove(CardId card)
+{
+    if (counts[card] == 0)
+    {
+        return false;
+    }
+    counts[card]--;
+    total--;
+    return true;
+}
+
+// Cartes restantes dans l'ordre des identifiants
+//  按标识顺序列出剩余卡片
+std::vector<CardId> Deck::toVector() const
+{
+    std::vector<CardId> cards;
+    cards.reserve(total);
+    for (CardId card = 0; card < CardIds::COUNT; card++)
+    {
+        cards.insert(cards.end(), counts[card], card);
+    }
+    return cards;
+}
@@ -4,23 +4,17 @@
 #include <fstream>
 #include <algorithm>
 #include <iomanip>
+#include <sstream>
 #include "Utils.h"
+#include "BinaryIO.h"
 #include <nlohmann/json.hpp>
 
 using json = nlohmann::json;
 
-// Définir toutes les cartes de royaume disponibles
-//  定义所有可用的王国卡
-const std::vector<std::string> Game::ALL_KINGDOM_CARDS = {
-    "Village", "Woodcutter", "Militia", "Market",
-    "Smithy", "CouncilRoom", "Moneylender", "Moat",
-    "Workshop", "Cellar", "Witch", "Thief",
-    "Gardens", "Chapel", "Feast", "Laboratory"};
-
 // Constructeur (nombre de joueurs, chargement ou non des archives, jeu de cartes du royaume)
 //  构造函数(玩家数量, 是否加载存档, 王国卡集)
 Game::Game(int numPlayers, bool isLoading, const std::string &kingdomSet)
-    : currentPlayer(0), turnCount(1)
+    : currentPlayer(0), turnCount(1), seed(Random::randomSeed()), rng(seed), verbose(true)
 {
 
     // Si l'archive n'est pas chargée, créez un nouveau jeu
@@ -51,7 +45,7 @@ Game::Game(int numPlayers, bool isLoading, const std::string &kingdomSet)
                 std::string playerName;
                 std::cout << "Entrez le nom du joueur " << (i + 1) << " : ";
                 std::getline(std::cin, playerName);
-                players.emplace_back(playerName);
+                players.emplace_back(playerName, &memory->pool);
             }
 
             // Sélectionnez la méthode d'initialisation de la carte du royaume en fonction des paramètres
@@ -68,9 +62,10 @@ Game::Game(int numPlayers, bool isLoading, const std::string &kingdomSet)
                 selectedCards = selectKingdomCards();
             }
 
-            // Enregistre la carte du royaume sélectionnée
-            //  记录选择的王国卡
+            // Enregistre la carte du royaume sélectionnée et la graine (pour rejouer la partie)
+            //  记录选择的王国卡和种子(用于重现对局)
             logger.logKingdomCardSelection(selectedCards);
+            logger.logText(GameLogger::SYSTEM_PLAYER, 0, "Graine de la partie: " + std::to_string(seed));
 
             // Initialiser le jeu
             //  初始化游戏
@@ -79,19 +74,97 @@ Game::Game(int numPlayers, bool isLoading, const std::string &kingdomSet)
     }
 }
 
-// Récupère la carte du royaume par défaut
-//  获取预设王国卡
-std::vector<std::string> Game::getPresetKingdomCards(const std::string &setName)
+// Constructeur sans saisie (noms des joueurs, cartes du royaume) -pour les bots et les tests de charge
+//  无输入的构造函数(玩家名称, 王国卡) - 用于机器人和压力测试
+Game::Game(const std::vector<std::string> &playerNames, const std::vector<std::string> &kingdomCards,
+           std::uint64_t seed)
+    : currentPlayer(0), turnCount(1), seed(seed), rng(seed), verbose(true)
 {
-    const std::map<std::string, std::vector<std::string>> PRESET_SETS = {
+    for (const auto &playerName : playerNames)
+    {
+        players.emplace_back(playerName, &memory->pool);
+    }
+
+    logger.logKingdomCardSelection(kingdomCards);
+    initialize(kingdomCards);
+}
+
+// Relancer une partie sans saisie dans cet objet : même état qu'une partie construite avec ces arguments,
+// mais les vecteurs des joueurs, du journal et des noms gardent leur capacité
+//  在本对象中重新开始无输入的对局: 状态与用这些参数构造的对局相同,
+//  但玩家、日志和名称的向量保留其容量
+void Game::reset(std::uint64_t newSeed, const std::vector<std::string> &kingdomCards,
+                 const std::vector<std::string> &playerNames)
+{
+    // Arrêter l'enregistrement : chaque joueur retrouve le fournisseur enveloppé par recordReplay,
+    // sinon les enregistreurs continueraient d'allonger un rejeu que plus rien ne peut lire
+    //  停止记录: 每个玩家恢复被 recordReplay 包装的提供者, 否则记录器会继续扩充一个再也无法读取的回放
+    if (replay)
+    {
+        for (auto &player : players)
+        {
+            auto recorder = std::dynamic_pointer_cast<RecordingDecisionProvider>(player.getDecisionProviderPtr());
+            if (recorder && recorder->getReplay() == replay)
+            {
+                player.setDecisionProvider(recorder->getInner());
+            }
+        }
+        replay.reset();
+    }
+
+    if (players.size() > playerNames.size())
+    {
+        players.erase(players.begin() + static_cast<std::ptrdiff_t>(playerNames.size()), players.end());
+    }
+    for (size_t i = 0; i < playerNames.size(); i++)
+    {
+        if (i < players.size())
+        {
+            players[i].reset(playerNames[i]);
+            players[i].getDecisionProvider().reset();
+        }
+        else
+        {
+            players.emplace_back(playerNames[i], &memory->pool);
+            players.back().setVerbose(verbose);
+        }
+    }
+
+    supply.clear();
+    currentPlayer = 0;
+    turnCount = 1;
+    seed = newSeed;
+    rng.reseed(newSeed);
+    logger.reset();
+
+    logger.logKingdomCardSelection(kingdomCards);
+    initialize(kingdomCards);
+}
+
+// Ensemble fixe de cartes du royaume ('beginner' ou 'advanced'), vide si inconnu
+//  固定的王国卡套装('beginner' 或 'advanced'), 未知时为空
+std::vector<std::string> Game::getFixedKingdomSet(const std::string &setName)
+{
+    static const std::map<std::string, std::vector<std::string>> PRESET_SETS = {
         {"beginner", {"Village", "Cellar", "Moat", "Woodcutter", "Workshop", "Militia", "Market", "Smithy", "CouncilRoom", "Laboratory"}},
-        {"advanced", {"Village", "Chapel", "Witch", "Gardens", "Laboratory", "Market", "Smithy", "Militia", "Moneylender", "Thief"}},
-        {"random", getRandomKingdomCards()}};
+        {"advanced", {"Village", "Chapel", "Witch", "Gardens", "Laboratory", "Market", "Smithy", "Militia", "Moneylender", "Thief"}}};
 
     auto it = PRESET_SETS.find(Utils::toLower(setName));
-    if (it != PRESET_SETS.end())
+    return it != PRESET_SETS.end() ? it->second : std::vector<std::string>();
+}
+
+// Récupère la carte du royaume par défaut
+//  获取预设王国卡
+std::vector<std::string> Game::getPresetKingdomCards(const std::string &setName)
+{
+    auto fixedSet = getFixedKingdomSet(setName);
+    if (!fixedSet.empty())
     {
-        return it->second;
+        return fixedSet;
+    }
+    if (Utils::equalIgnoreCase(setName, "random"))
+    {
+        return getRandomKingdomCards();
     }
 
     std::cout << "Ensemble prédéfini inconnu, sélection aléatoire utilisée\n"; // 未知套装, 随机选择
@@ -131,6 +204,7 @@ std::vector<std::string> Game::selectPresetCards()
 //  初始化游戏 - 使用选中的王国卡
 void Game::initialize(const std::vector<std::string> &selectedCards)
 {
+    syncLoggerPlayers();
 
     // Initialiser la pile d'approvisionnement de la carte de base
     // Initialiser la réserve de cartes du royaume
@@ -144,35 +218,33 @@ void Game::initialize(const std::vector<std::string> &selectedCards)
     {
         // Initialiser la pile d'approvisionnement de la carte de base
         //  初始化基础卡供应堆
-        const std::vector<std::pair<std::string, int>> basicCards = {
-            {"Copper", 60}, // Pièces de cuivre -60 pièces
-                            //  铜币 - 60张
-            {"Silver", 40}, // Pièces d'argent -40 cartes
-                            //  银币 - 40张
-            {"Gold", 30},   // Pièces d'or -30 pièces
+        // Tableau sur la pile : pas d'allocation quand Game::reset relance une partie
+        //  栈上的数组: Game::reset 重新开局时无内存分配
+        const std::array<std::pair<CardId, int>, 7> basicCards = {{
+            {CardIds::COPPER, 60}, // Pièces de cuivre -60 pièces
+                                   //  铜币 - 60张
+            {CardIds::SILVER, 40}, // Pièces d'argent -40 cartes
+                                   //  银币 - 40张
+            {CardIds::GOLD, 30},   // Pièces d'or -30 pièces
             //{"Estate", Players.size() <= 2 ? 8 + Players.size()*3 : 12 + Players.size()*3}, //Le domaine (!! est difficile à réparer, donc ajouter des joueurs directement Quantité*3)
             // 金币 - 30张
             // {"Estate", players.size() <= 2 ? 8 + players.size()*3 : 12 + players.size()*3},    // 庄园(!!难以修复, 所以直接加玩家数量*3)
-            {"Estate", players.size() <= 2 ? 8 : 12}, // Manoir (!! C'est difficile à réparer, donc augmentez simplement le nombre de joueurs *3)
-                                                      //  庄园(!!难以修复, 所以直接加玩家数量*3)
+            {CardIds::ESTATE, players.size() <= 2 ? 8 : 12}, // Manoir (!! C'est difficile à réparer, donc augmentez simplement le nombre de joueurs *3)
+                                                             //  庄园(!!难以修复, 所以直接加玩家数量*3)
 
-            {"Duchy", players.size() <= 2 ? 8 : 12},                              // Duché
-                                                                                  //  公爵领地
-            {"Province", players.size() <= 2 ? 8 : 12},                           // Province
-                                                                                  //  行省
-            {"Curse", players.size() == 2 ? 10 : (players.size() == 3 ? 20 : 30)} // carte malédiction
-                                                                                  //  诅咒卡
-        };
+            {CardIds::DUCHY, players.size() <= 2 ? 8 : 12},                              // Duché
+                                                                                         //  公爵领地
+            {CardIds::PROVINCE, players.size() <= 2 ? 8 : 12},                           // Province
+                                                                                         //  行省
+            {CardIds::CURSE, players.size() == 2 ? 10 : (players.size() == 3 ? 20 : 30)} // carte malédiction
+                                                                                         //  诅咒卡
+        }};
 
         // Initialiser la carte de base
         //  初始化基础卡
-        for (const auto &[cardName, count] : basicCards)
+        for (const auto &[card, count] : basicCards)
         {
-            supply[cardName] = std::vector<std::shared_ptr<Card>>();
-            for (int i = 0; i < count; i++)
-            {
-                supply[cardName].push_back(Card::createCard(cardName));
-            }
+            supply.setPile(card, count);
         }
 
         // Initialise la carte du royaume sélectionnée
@@ -181,11 +253,7 @@ void Game::initialize(const std::vector<std::string> &selectedCards)
         {
             try
             {
-                supply[cardName] = std::vector<std::shared_ptr<Card>>();
-                for (int i = 0; i < 10; i++)
-                {
-                    supply[cardName].push_back(Card::createCard(cardName));
-                }
+                supply.setPile(Card::idOf(cardName), 10);
             }
             catch (const std::exception &e)
             {
@@ -200,21 +268,24 @@ void Game::initialize(const std::vector<std::string> &selectedCards)
         // 7张铜币 + 3张庄园 + 5张起始手牌
         for (auto &player : players)
         {
+            // Chaque joueur mélange avec son propre flux, dérivé de la graine de la partie
+            //  每个玩家使用自己的随机流洗牌, 由对局种子派生
+            player.seedRandom(rng());
+
             // Supprime la carte initiale de la pile de réserve
             //  从供应堆中取出初始卡牌
             for (int i = 0; i < 7; i++)
             { // 7 pièces de cuivre
                 // 7张铜币
-                if (!supply["Copper"].empty())
+                if (supply.take(CardIds::COPPER))
                 {
-                    player.addToDiscard(supply["Copper"].back());
-                    supply["Copper"].pop_back();
+                    player.gainCard(CardIds::COPPER);
                 }
             }
             for (int i = 0; i < 3; i++)
             { // 3 manoirs
                 // 3张庄园
-                player.addToDiscard(Card::createCard("Estate"));
+                player.gainCard(CardIds::ESTATE);
             }
             player.shuffleDeck(); // mélanger
                                   //  洗牌
@@ -271,7 +342,7 @@ void Game::playGame()
         // 保存 /  游戏状态 / 继续 - save/ stats / to
         while (true)
         {
-            std::cout << "\nTapez 'save' pour sauvegarder le jeu, 'stats' pour voir les statistiques, 'go' pour continuer : "; // 输入 'save' 保存游戏，'stats' 查看统计信息，'go' 继续游戏
+            std::cout << "\nTapez 'save' pour sauvegarder le jeu, 'autosave N [fichier]' pour sauvegarder automatiquement tous les N tours, 'log fichier' pour écrire le journal dans un fichier, 'stats' pour voir les statistiques, 'go' pour continuer : "; // 输入 'save' 保存游戏，'autosave N [文件]' 每 N 回合自动保存，'log 文件' 将日志写入文件，'stats' 查看统计信息，'go' 继续游戏
             std::string command;
             std::getline(std::cin, command);
 
@@ -279,7 +350,7 @@ void Game::playGame()
             //  如果输入为保存
             if (Utils::equalIgnoreCase(command, "save"))
             {
-                std::cout << "Veuillez entrer un nom de fichier pour la sauvegarde (appuyez sur Entrée pour utiliser le nom par défaut * dominion_save.txt *: "; // 请输入存档文件名 (直接回车使用默认名称 'dominion_save.txt'):
+                std::cout << "Veuillez entrer un nom de fichier pour la sauvegarde (appuyez sur Entrée pour utiliser le nom par défaut * dominion_save.txt *, extension .dsb pour le format binaire) : "; // 请输入存档文件名 (直接回车使用默认名称 'dominion_save.txt', 扩展名 .dsb 为二进制格式):
                 std::string filename;
                 std::getline(std::cin, filename);
 
@@ -287,7 +358,7 @@ void Game::playGame()
                 {
                     filename = "dominion_save.txt";
                 }
-                else if (filename.find(".txt") == std::string::npos)
+                else if (filename.find(".txt") == std::string::npos && !isBinarySaveFile(filename))
                 {
                     filename += ".txt";
                 }
@@ -316,6 +387,49 @@ void Game::playGame()
                           //  返回命令输入循环
             }
 
+            // Sauvegarde automatique : autosave N [fichier] (N = 0 pour l'arrêter)
+            //  自动保存: autosave N [文件] (N = 0 表示停止)
+            else if (Utils::equalIgnoreCase(command.substr(0, 8), "autosave"))
+            {
+                std::istringstream arguments(command.substr(8));
+                int everyTurns = -1;
+                std::string filename = "dominion_autosave.txt";
+                arguments >> everyTurns >> filename;
+                if (everyTurns < 0)
+                {
+                    std::cout << "Utilisation: autosave N [fichier]\n"; // 用法: autosave N [文件]
+                    continue;
+                }
+                setAutosave(filename, everyTurns);
+                if (everyTurns == 0)
+                    std::cout << "Sauvegarde automatique désactivée\n"; // 自动保存已关闭
+                else
+                    std::cout << "Sauvegarde automatique tous les " << everyTurns << " tours dans " << filename << "\n"; // 每 N 回合自动保存到文件
+                continue;
+            }
+
+            // Journal en flux : log fichier (log seul pour l'arrêter)
+            //  流式日志: log 文件 (只输入 log 表示停止)
+            else if (Utils::equalIgnoreCase(command.substr(0, 3), "log") && (command.size() == 3 || command[3] == ' '))
+            {
+                std::istringstream arguments(command.substr(3));
+                std::string filename;
+                arguments >> filename;
+                try
+                {
+                    streamLog(filename);
+                    if (filename.empty())
+                        std::cout << "Journal gardé en mémoire\n"; // 日志保存在内存中
+                    else
+                        std::cout << "Journal écrit dans " << filename << "\n"; // 日志写入文件
+                }
+                catch (const std::exception &e)
+                {
+                    std::cout << e.what() << "\n";
+                }
+                continue;
+            }
+
             // Si l'entrée consiste à afficher des statistiques
             //  如果输入为查看统计信息
             else if (Utils::equalIgnoreCase(command, "stats"))
@@ -337,7 +451,7 @@ void Game::playGame()
             //  如果输入不为空, 提示无效命令
             else if (!command.empty())
             {
-                std::cout << "Commande invalide. Veuillez entrer 'save', 'stats' ou 'go'\n"; // 无效的命令。请输入 'save'、'stats' 或 'go'
+                std::cout << "Commande invalide. Veuillez entrer 'save', 'autosave', 'log', 'stats' ou 'go'\n"; // 无效的命令。请输入 'save'、'autosave'、'log'、'stats' 或 'go'
                 continue;                                                                    // Retour à la boucle d'entrée de la commande
                                                                                              //  返回命令输入循环
             }
@@ -350,9 +464,17 @@ void Game::playGame()
     // Sauvegarde automatique à la fin du jeu
     //  游戏结束时
     // 游戏结束时自动保存
+    // localtime partage un tampon entre les threads : version réentrante
+    //  localtime 在线程之间共享缓冲区: 使用可重入版本
     std::time_t now = std::time(nullptr);
+    std::tm localTime{};
+#ifdef _WIN32
+    localtime_s(&localTime, &now);
+#else
+    localtime_r(&now, &localTime);
+#endif
     char timeStr[20];
-    strftime(timeStr, sizeof(timeStr), "%Y%m%d_%H%M%S", localtime(&now));
+    strftime(timeStr, sizeof(timeStr), "%Y%m%d_%H%M%S", &localTime);
     std::string autoSaveFilename = "dominion_autosave_" + std::string(timeStr) + ".txt";
 
     std::cout << "\nGame over, création de la sauvegarde automatique...\n"; // 游戏结束，正在创建自动存档...
@@ -364,6 +486,142 @@ void Game::playGame()
     displayResults(scores);
 }
 
+// Jouer la partie jusqu'à la fin sans commande entre les tours (maxTurns = 0 : pas de limite)
+// Renvoie false si la limite de tours est atteinte avant la fin du jeu
+//  不在回合之间等待命令, 一直进行到游戏结束(maxTurns = 0: 不限制)
+//  如果在游戏结束前达到回合上限, 返回 false
+bool Game::runHeadless(int maxTurns)
+{
+    while (!isGameOver())
+    {
+        if (maxTurns > 0 && turnCount > maxTurns)
+        {
+            return false;
+        }
+        playTurn();
+    }
+    return true;
+}
+
+// Copie de l'état de jeu seul : journal désactivé, affichage coupé
+//  仅复制游戏状态: 关闭日志, 关闭显示
+Game::Game(const Game &other, ForkTag)
+    : supply(other.supply), currentPlayer(other.currentPlayer),
+      turnCount(other.turnCount), logger(false), seed(other.seed), rng(other.rng), verbose(false)
+{
+    copyPlayersFrom(other.players);
+}
+
+// Copie pour la sauvegarde automatique : comme fork, mais avec le journal
+//  用于自动存档的副本: 与 fork 相同, 但包含日志
+Game::Game(const Game &other, SnapshotTag)
+    : supply(other.supply), currentPlayer(other.currentPlayer),
+      turnCount(other.turnCount), seed(other.seed), rng(other.rng), verbose(false)
+{
+    copyPlayersFrom(other.players);
+    logger = other.logger;
+}
+
+// Copie indépendante pour la recherche
+//  用于搜索的独立副本
+Game Game::fork() const
+{
+    return Game(*this, ForkTag{});
+}
+
+// Enregistrer les décisions : chaque fournisseur est enveloppé par un enregistreur qui écrit dans le même rejeu
+//  记录决策: 每个提供者都被包装在写入同一回放的记录器中
+void Game::recordReplay(int maxTurns)
+{
+    if (turnCount != 1 || currentPlayer != 0)
+    {
+        throw std::logic_error("Le rejeu doit être enregistré dès le premier tour"); // 必须从第一回合开始记录回放
+    }
+    replay = std::make_shared<Replay>();
+    replay->seed = seed;
+    replay->maxTurns = maxTurns;
+    replay->kingdomCards = getKingdomCards();
+    for (auto &player : players)
+    {
+        replay->playerNames.push_back(player.getName());
+        auto recorder = std::make_shared<RecordingDecisionProvider>(player.getDecisionProviderPtr(), replay);
+        player.setDecisionProvider(recorder);
+    }
+}
+
+// Rejeu enregistré jusqu'ici, avec l'empreinte de l'état actuel
+//  目前为止记录的回放, 附带当前状态的哈希
+Replay Game::getReplay() const
+{
+    if (!replay)
+    {
+        throw std::logic_error("Aucun rejeu en cours d'enregistrement"); // 没有正在记录的回放
+    }
+    Replay result = *replay;
+    result.finalStateHash = stateHash();
+    return result;
+}
+
+// Cartes du royaume de la réserve, dans l'ordre des identifiants
+//  供应堆中的王国卡, 按标识顺序
+std::vector<std::string> Game::getKingdomCards() const
+{
+    std::vector<std::string> cards;
+    for (CardId card = CardIds::FIRST_KINGDOM; card < CardIds::COUNT; card++)
+    {
+        if (supply.contains(card))
+        {
+            cards.push_back(CARD_DEFINITIONS[card].factoryName);
+        }
+    }
+    return cards;
+}
+
+// Recopier l'état de jeu : l'affectation des vecteurs réutilise leur capacité
+//  复制游戏状态: 向量赋值会复用其容量
+void Game::copyStateFrom(const Game &other)
+{
+    copyPlayersFrom(other.players);
+    supply = other.supply;
+    currentPlayer = other.currentPlayer;
+    turnCount = other.turnCount;
+    seed = other.seed;
+    rng = other.rng;
+}
+
+// Un joueur de plus est d'abord construit dans la mémoire de cette partie, puis affecté : une copie
+// directe prendrait la mémoire par défaut
+//  多出的玩家先在本局的内存中构造, 再赋值: 直接复制会使用默认内存
+void Game::copyPlayersFrom(const std::vector<Player> &source)
+{
+    if (players.size() > source.size())
+    {
+        players.erase(players.begin() + static_cast<std::ptrdiff_t>(source.size()), players.end());
+    }
+    players.reserve(source.size());
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        if (i == players.size())
+        {
+            players.emplace_back(source[i].getName(), &memory->pool);
+        }
+        players[i] = source[i];
+        players[i].setVerbose(verbose);
+    }
+}
+
+// Remélanger l'information cachée : l'observateur connaît sa main, pas l'ordre des pioches ni les mains adverses
+//  重新洗混隐藏信息: 观察者知道自己的手牌, 但不知道牌堆顺序和对手的手牌
+void Game::randomizeHiddenState(std::uint64_t seed, int observer)
+{
+    Random source(seed);
+    rng.reseed(source());
+    for (size_t i = 0; i < players.size(); i++)
+    {
+        players[i].shuffleHidden(source(), static_cast<int>(i) != observer);
+    }
+}
+
 // Effectuer le tour
 // Affiche le nombre de tours + le nom du joueur
 // Afficher l'état du deck
@@ -383,23 +641,36 @@ void Game::playTurn()
     Player &currentPlayerRef = players[currentPlayer]; // Récupère le joueur actuel
                                                        //  获取当前玩家
 
-    // Affiche le nombre de tours + le nom du joueur
-    //  显示回合数 + 玩家名
-    std::cout << "\n========== Tour " << turnCount << " - "
-              << currentPlayerRef.getName() << " ==========\n";
+    if (verbose)
+    {
+        // Affiche le nombre de tours + le nom du joueur
+        //  显示回合数 + 玩家名
+        std::cout << "\n========== Tour " << turnCount << " - "
+                  << currentPlayerRef.getName() << " ==========\n";
 
-    // Afficher l'état du deck
-    //  显示牌堆状态
-    currentPlayerRef.showDeckStatus();
+        // Afficher l'état du deck
+        //  显示牌堆状态
+        currentPlayerRef.showDeckStatus();
+
+        // Afficher la main actuelle
+        //  显示当前手牌
+        std::cout << "[" << currentPlayerRef.getName() << "] ";
+        currentPlayerRef.showHand();
+    }
 
-    // Afficher la main actuelle
-    //  显示当前手牌
-    std::cout << "[" << currentPlayerRef.getName() << "] ";
-    currentPlayerRef.showHand();
+    finishTurn(TurnPhase::ACTION);
+}
 
+// Terminer le tour : phase d'action (si demandée), d'achat et de nettoyage, puis joueur suivant
+//  完成回合: 行动阶段(如需要)、购买阶段和清理阶段, 然后下一个玩家
+void Game::finishTurn(TurnPhase from)
+{
     // phase d'action
     //  行动阶段
-    playActionPhase();
+    if (from == TurnPhase::ACTION)
+    {
+        playActionPhase();
+    }
 
     // Étape d'achat
     //  购买阶段
@@ -418,6 +689,10 @@ void Game::playTurn()
     if (currentPlayer == 0)
     {
         turnCount++;
+        if (autosaver && (turnCount - 1) % autosaveInterval == 0)
+        {
+            autosave();
+        }
     }
 }
 
@@ -427,62 +702,52 @@ void Game::playActionPhase()
 {
     Player &currentPlayerRef = players[currentPlayer];
 
-    std::cout << "\n[Tour " << turnCount << " - Phase d'Action]\n";
+    if (verbose)
+        std::cout << "\n[Tour " << turnCount << " - Phase d'Action]\n";
 
     while (currentPlayerRef.getActions() > 0)
     {
-        std::cout << "[Tour " << turnCount << "] "
-                  << currentPlayerRef.getName()
-                  << " a: " << currentPlayerRef.getActions() << " points d'action\n\n";
+        if (verbose)
+        {
+            std::cout << "[Tour " << turnCount << "] "
+                      << currentPlayerRef.getName()
+                      << " a: " << currentPlayerRef.getActions() << " points d'action\n\n";
 
-        // Afficher la main actuelle
-        //  显示当前手牌
-        currentPlayerRef.showHand();
-        std::cout << "\n";
+            // Afficher la main actuelle
+            //  显示当前手牌
+            currentPlayerRef.showHand();
+            std::cout << "\n";
+        }
 
         if (!currentPlayerRef.hasActionCard())
         {
-            std::cout << "Il n'y a pas de cartes d'action disponibles\n";
+            if (verbose)
+                std::cout << "Il n'y a pas de cartes d'action disponibles\n";
             break;
         }
 
-        std::cout << "[Tour " << turnCount << "] "
-                  << currentPlayerRef.getName()
-                  << " choisissez une carte d'action à utiliser ('show' pour voir les cartes, 'info [nom de carte]' pour voir la description, 'skip' pour passer): ";
-
-        std::string input;
-        std::getline(std::cin, input);
-
-        if (Utils::equalIgnoreCase(input, "skip"))
+        // Demander la carte à jouer (chaîne vide : passer)
+        //  询问要使用的卡片(空字符串: 跳过)
+        CardId choice = currentPlayerRef.getDecisionProvider().chooseAction(currentPlayerRef, *this);
+        if (choice == CardIds::INVALID)
         {
             break;
         }
-        else if (Utils::equalIgnoreCase(input, "show"))
-        {
-            currentPlayerRef.showHand();
-            std::cout << "\n";
-            continue;
-        }
-        else if (input.substr(0, 4) == "info")
-        {
-            std::string cardName = input.substr(5);
-            currentPlayerRef.showCardDescription(cardName);
-            continue;
-        }
 
         // essaie d'utiliser la carte d'action
         //  尝试使用行动卡
         try
         {
-            if (currentPlayerRef.playAction(input, *this))
+            if (currentPlayerRef.playAction(choice, *this))
             {
                 currentPlayerRef.useAction();
-                logger.recordCardPlayed(input);
+                logger.recordCardPlayed(choice);
             }
         }
         catch (const std::exception &e)
         {
-            std::cout << "Échec de l'utilisation de la carte mobile: " << e.what() << "\n"; // 使用行动卡失败:
+            if (verbose)
+                std::cout << "Échec de l'utilisation de la carte mobile: " << e.what() << "\n"; // 使用行动卡失败:
             continue;
         }
     }
@@ -494,77 +759,60 @@ void Game::playBuyPhase()
 {
     Player &currentPlayerRef = players[currentPlayer];
 
-    std::cout << "\n=== Phase d'Achat de " << currentPlayerRef.getName() << "  ===\n";
+    if (verbose)
+        std::cout << "\n=== Phase d'Achat de " << currentPlayerRef.getName() << "  ===\n";
     currentPlayerRef.playAllTreasures();
 
     while (currentPlayerRef.getBuys() > 0)
     {
         int availableCoins = currentPlayerRef.getCoins();
-        std::cout << "\n[" << currentPlayerRef.getName() << "] Nombre d'achats restants: "
-                  << currentPlayerRef.getBuys() << "\n";
-
-        // Afficher les cartes disponibles
-        //  显示可购买的卡片
-        displaySupplyPiles();
-
-        // Afficher les pièces d'or disponibles
-        //  显示可用金币
-        std::cout << "\n[" << currentPlayerRef.getName() << "] Pièces disponibles: "
-                  << availableCoins << "\n";
-
-        std::cout << "[" << currentPlayerRef.getName()
-                  << "] Entrez le nom de la carte à acheter, ou 'done' pour terminer la phase d'achat: ";
 
-        std::string input;
-        std::getline(std::cin, input);
-
-        if (Utils::equalIgnoreCase(input, "done"))
+        // Demander la carte à acheter (chaîne vide : terminer)
+        //  询问要购买的卡片(空字符串: 结束)
+        CardId choice = currentPlayerRef.getDecisionProvider().chooseBuy(currentPlayerRef, *this);
+        if (choice == CardIds::INVALID)
             break;
 
-        auto it = std::find_if(supply.begin(), supply.end(),
-                               [&input](const auto &pair)
-                               {
-                                   return Utils::equalIgnoreCase(pair.first, input);
-                               });
-
-        if (it != supply.end() && !it->second.empty())
+        if (!supply.isEmpty(choice))
         {
-            int cardCost = it->second[0]->getCost();
+            const Card &card = Card::get(choice);
+            int cardCost = card.getCost();
             if (cardCost <= availableCoins)
             {
                 // Acheter une carte
                 //  购买卡片
-                std::shared_ptr<Card> boughtCard = it->second.back();
-                it->second.pop_back();
-                currentPlayerRef.addToDiscard(boughtCard);
+                supply.take(choice);
+                currentPlayerRef.gainCard(choice);
                 currentPlayerRef.spendCoins(cardCost);
                 currentPlayerRef.useBuy();
 
-                logger.recordCardBought(it->first);
-                logger.logAction(currentPlayerRef.getName(),
-                                 "a acheté " + it->first + " (coût: " + std::to_string(cardCost) + " pièces)");
+                logger.recordCardBought(choice);
+                logEvent(GameEventKind::CARD_BOUGHT, currentPlayerRef, choice, cardCost);
 
-                std::cout << "Achat de " << it->first << " réussi!\n";
+                if (verbose)
+                    std::cout << "Achat de " << card.getName() << " réussi!\n";
 
                 if (currentPlayerRef.getBuys() == 0)
                 {
-                    std::cout << "Plus de tentatives d'achat disponibles\n";
+                    if (verbose)
+                        std::cout << "Plus de tentatives d'achat disponibles\n";
                     break;
                 }
                 if (currentPlayerRef.getCoins() == 0)
                 {
-                    std::cout << "Plus de pièces disponibles\n";
+                    if (verbose)
+                        std::cout << "Plus de pièces disponibles\n";
                     break;
                 }
             }
-            else
+            else if (verbose)
             {
                 std::cout << "Pas assez de pièces! Il vous faut " << cardCost << " pièces\n";
             }
         }
-        else
+        else if (verbose)
         {
-            if (it == supply.end())
+            if (!supply.contains(choice))
             {
                 std::cout << "Carte introuvable\n";
             }
@@ -599,7 +847,8 @@ bool Game::isGameOver() const
     //  1. 检查Province堆是否为空
     if (isProvinceEmpty())
     {
-        std::cout << "\n*** Fin du jeu: La pile de Province est épuisée! ***\n";
+        if (verbose)
+            std::cout << "\n*** Fin du jeu: La pile de Province est épuisée! ***\n";
         return true;
     }
 
@@ -608,7 +857,8 @@ bool Game::isGameOver() const
     int emptyPiles = getEmptyPiles();
     if (emptyPiles >= 3)
     {
-        std::cout << "\n*** Fin du jeu: " << emptyPiles << " piles de cartes sont épuisées! ***\n";
+        if (verbose)
+            std::cout << "\n*** Fin du jeu: " << emptyPiles << " piles de cartes sont épuisées! ***\n";
         return true;
     }
 
@@ -619,27 +869,16 @@ bool Game::isGameOver() const
 //  检查Province堆是否为空
 bool Game::isProvinceEmpty() const
 {
-    auto it = supply.find("Province");
-    return it == supply.end() || it->second.empty();
+    return supply.isEmpty(CardIds::PROVINCE);
 }
 
 // Vérifiez combien de fournitures de tas sont vides
 //  检查有多少堆供应为空
 int Game::getEmptyPiles() const
 {
-    int emptyPiles = 0;
-
-    // Vérifiez toutes les piles de ravitaillement, y compris les cartes de base et de royaume
-    //  检查所有供应堆，包括基础卡和王国卡
-    for (const auto &[cardName, pile] : supply)
-    {
-        if (pile.empty())
-        {
-            emptyPiles++;
-        }
-    }
-
-    return emptyPiles;
+    // Compteur tenu à jour par la réserve (cartes de base et de royaume)
+    //  由供应堆维护的计数(包括基础卡和王国卡)
+    return supply.getEmptyPiles();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -651,6 +890,14 @@ int Game::getEmptyPiles() const
 //  保存游戏
 void Game::saveGame(const std::string &filename)
 {
+    if (isBinarySaveFile(filename))
+    {
+        saveBinary(filename);
+        if (verbose)
+            std::cout << "Le jeu a été sauvegardé avec succès dans " << filename << "\n";
+        return;
+    }
+
     try
     {
         json saveData;
@@ -659,6 +906,8 @@ void Game::saveGame(const std::string &filename)
         //  保存基本游戏信息
         saveData["turn_count"] = turnCount;
         saveData["current_player"] = currentPlayer;
+        saveData["seed"] = seed;
+        saveData["rng"] = rng.getState();
 
         // Enregistrer les informations du joueur
         //  保存玩家信息
@@ -672,9 +921,12 @@ void Game::saveGame(const std::string &filename)
         // Enregistrer l'état du tas d'approvisionnement
         //  保存供应堆状态
         json supplyJson;
-        for (const auto &[cardName, pile] : supply)
+        for (CardId id = 0; id < CardIds::COUNT; id++)
         {
-            supplyJson[cardName] = pile.size();
+            if (supply.contains(id))
+            {
+                supplyJson[Card::get(id).getName()] = supply.count(id);
+            }
         }
         saveData["supply"] = supplyJson;
 
@@ -691,15 +943,69 @@ void Game::saveGame(const std::string &filename)
         }
         out << std::setw(4) << saveData << std::endl;
 
-        std::cout << "e jeu a été sauvegardé avec succès dans " << filename << "\n";
+        if (verbose)
+            std::cout << "e jeu a été sauvegardé avec succès dans " << filename << "\n";
     }
     catch (const std::exception &e)
     {
-        std::cout << "Erreur lors de la sauvegarde du jeu: " << e.what() << "\n";
+        if (verbose)
+            std::cout << "Erreur lors de la sauvegarde du jeu: " << e.what() << "\n";
         throw;
     }
 }
 
+void Game::streamLog(const std::string &filename)
+{
+    logger.streamTo(filename);
+}
+
+void Game::setLogCapacity(std::size_t maxEvents)
+{
+    logger.setCapacity(maxEvents);
+}
+
+// Sauvegarde automatique : remplace l'éventuelle sauvegarde automatique précédente (ses écritures en cours sont terminées)
+//  自动存档: 替换之前的自动存档设置(先完成其正在进行的写入)
+void Game::setAutosave(const std::string &filename, int everyTurns)
+{
+    if (everyTurns < 0)
+    {
+        throw std::invalid_argument("Intervalle de sauvegarde automatique négatif"); // 自动存档间隔为负
+    }
+    autosaver.reset();
+    autosaveInterval = everyTurns;
+    if (everyTurns > 0)
+    {
+        autosaver = std::make_unique<AutoSaver>(filename);
+    }
+}
+
+void Game::flushAutosave()
+{
+    if (!autosaver)
+    {
+        return;
+    }
+    autosaver->flush();
+    std::string error = autosaver->takeError();
+    if (!error.empty())
+    {
+        throw std::runtime_error("Échec de la sauvegarde automatique: " + error); // 自动存档失败
+    }
+}
+
+// Sur le thread de jeu : signaler l'échec de l'écriture précédente, copier l'état et le confier au thread d'écriture
+//  在游戏线程上: 报告上一次写入的失败, 复制状态并交给写入线程
+void Game::autosave()
+{
+    std::string error = autosaver->takeError();
+    if (!error.empty() && verbose)
+    {
+        std::cout << "Échec de la sauvegarde automatique: " << error << "\n"; // 自动存档失败
+    }
+    autosaver->submit(std::unique_ptr<Game>(new Game(*this, SnapshotTag{})));
+}
+
 // Extrait la liste des cartes du royaume du tas d'approvisionnement JSON
 //  从供应堆JSON中提取王国卡列表
 std::vector<std::string> Game::extractKingdomCardsFromSupply(const json &supplyJson) const
@@ -728,14 +1034,26 @@ void Game::initializeFromSave(const json &saveData)
     turnCount = saveData["turn_count"];
     currentPlayer = saveData["current_player"];
 
+    // Graine et état du générateur (anciennes sauvegardes : nouvelle graine)
+    //  种子和生成器状态(旧存档: 使用新种子)
+    if (saveData.contains("rng"))
+    {
+        seed = saveData["seed"].get<std::uint64_t>();
+        rng.setState(saveData["rng"].get<Random::State>());
+    }
+
     // Charger les informations du joueur
     //  加载玩家信息
     players.clear();
     for (const auto &playerJson : saveData["players"])
     {
-        Player player(playerJson["name"]);
+        Player player(playerJson["name"], &memory->pool);
         player.fromJson(playerJson);
-        players.push_back(player);
+        if (!playerJson.contains("rng"))
+        {
+            player.seedRandom(rng());
+        }
+        players.push_back(std::move(player));
     }
 
     // Restaurer l'état du tas d'approvisionnement directement à partir de l'archive
@@ -743,23 +1061,29 @@ void Game::initializeFromSave(const json &saveData)
     supply.clear();
     for (const auto &[cardName, count] : saveData["supply"].items())
     {
-        supply[cardName] = std::vector<std::shared_ptr<Card>>();
-        for (int i = 0; i < count.get<int>(); i++)
-        {
-            supply[cardName].push_back(Card::createCard(cardName));
-        }
+        supply.setPile(Card::idOf(cardName), count.get<int>());
     }
 
     // Charger le journal du jeu
     //  加载游戏日志
     logger.fromJson(saveData["game_log"]);
+    syncLoggerPlayers();
 }
 
 // Charger le jeu
 //  加载游戏
 void Game::loadGame(const std::string &filename)
 {
-    std::cout << "\nChargement du jeu...\n";
+    if (verbose)
+        std::cout << "\nChargement du jeu...\n";
+
+    if (isBinarySaveFile(filename))
+    {
+        loadBinary(filename);
+        if (verbose)
+            std::cout << "Le jeu: " << filename << " est chargé\n";
+        return;
+    }
 
     try
     {
@@ -786,12 +1110,20 @@ void Game::loadGame(const std::string &filename)
         turnCount = saveData["turn_count"];
         currentPlayer = saveData["current_player"];
 
+        // Graine et état du générateur (anciennes sauvegardes : nouvelle graine)
+        //  种子和生成器状态(旧存档: 使用新种子)
+        if (saveData.contains("rng"))
+        {
+            seed = saveData["seed"].get<std::uint64_t>();
+            rng.setState(saveData["rng"].get<Random::State>());
+        }
+
         // Charger les informations du joueur
         //  加载玩家信息
         players.clear();
         for (const auto &playerJson : saveData["players"])
         {
-            Player player(playerJson["name"]);
+            Player player(playerJson["name"], &memory->pool);
 
             // Définir le statut du joueur
             //  设置玩家状态
@@ -803,17 +1135,25 @@ void Game::loadGame(const std::string &filename)
             //  加载牌组
             for (const auto &cardName : playerJson["deck"])
             {
-                player.addToDeck(Card::createCard(cardName));
+                player.addToDeck(Card::idOf(cardName));
             }
 
             for (const auto &cardName : playerJson["hand"])
             {
-                player.addToHand(Card::createCard(cardName));
+                player.addToHand(Card::idOf(cardName));
             }
 
             for (const auto &cardName : playerJson["discard"])
             {
-                player.addToDiscard(Card::createCard(cardName));
+                player.addToDiscard(Card::idOf(cardName));
+            }
+
+            if (playerJson.contains("in_play"))
+            {
+                for (const auto &cardName : playerJson["in_play"])
+                {
+                    player.addToPlay(Card::idOf(cardName));
+                }
             }
 
             if (playerJson.contains("trash"))
@@ -822,10 +1162,23 @@ void Game::loadGame(const std::string &filename)
                 {
                     // gère les cartes rejetées
                     //  处理废弃牌
-                    player.addToTrash(Card::createCard(cardName));
+                    player.addToTrash(Card::idOf(cardName));
                 }
             }
 
+            // Reprendre le flux aléatoire du joueur là où il s'était arrêté
+            //  从中断处继续玩家的随机流
+            if (playerJson.contains("rng"))
+            {
+                player.getRandom().setState(playerJson["rng"].get<Random::State>());
+            }
+            else
+            {
+                player.seedRandom(rng());
+            }
+
+            player.recountCards();
+            player.setVerbose(verbose);
             players.push_back(std::move(player));
         }
 
@@ -834,11 +1187,7 @@ void Game::loadGame(const std::string &filename)
         supply.clear();
         for (const auto &[cardName, count] : saveData["supply"].items())
         {
-            supply[cardName] = std::vector<std::shared_ptr<Card>>();
-            for (int i = 0; i < count.get<int>(); i++)
-            {
-                supply[cardName].push_back(Card::createCard(cardName));
-            }
+            supply.setPile(Card::idOf(cardName), count.get<int>());
         }
 
         // Charger le journal du jeu
@@ -847,6 +1196,7 @@ void Game::loadGame(const std::string &filename)
         {
             logger.fromJson(saveData["game_log"]);
         }
+        syncLoggerPlayers();
 
         std::cout << "Le jeu: " << filename << " est chargé\n";
         std::cout << "Tour actuel: " << turnCount << "\n";
@@ -858,39 +1208,152 @@ void Game::loadGame(const std::string &filename)
     }
 }
 
-// Calculer le score final
-//  计算最终得分
-std::vector<std::pair<std::string, int>> Game::calculateFinalScores() const
+// Extension des sauvegardes binaires
+//  二进制存档的扩展名
+const std::string Game::BINARY_SAVE_EXTENSION = ".dsb";
+
+// En-tête des sauvegardes binaires : signature et version du format
+// Version 2 : fichier du journal en flux après les statistiques ; la version 1 se charge toujours
+//  二进制存档的文件头: 签名和格式版本
+//  版本 2: 统计信息之后是流式日志文件; 仍可加载版本 1
+static const char BINARY_SAVE_MAGIC[4] = {'D', 'O', 'M', 'B'};
+static const std::uint16_t BINARY_SAVE_VERSION = 2;
+
+// Le fichier est-il une sauvegarde binaire (d'après son extension)
+//  根据扩展名判断文件是否为二进制存档
+bool Game::isBinarySaveFile(const std::string &filename)
 {
-    std::vector<std::pair<std::string, int>> scores;
+    return filename.size() >= BINARY_SAVE_EXTENSION.size() &&
+           Utils::equalIgnoreCase(filename.substr(filename.size() - BINARY_SAVE_EXTENSION.size()), BINARY_SAVE_EXTENSION);
+}
+
+// Sauvegarde binaire : en-tête, tour, joueur actuel, graine et générateur, réserve, joueurs, statistiques
+// Le texte du journal n'est pas inclus (en flux : seulement sa position), pour pouvoir sauvegarder à chaque tour
+//  二进制存档: 文件头、回合、当前玩家、种子和生成器、供应堆、玩家、统计信息
+//  不包含日志文本(流式时: 只有其位置), 以便每回合都能存档
+void Game::saveBinary(const std::string &filename) const
+{
+    BinaryWriter out;
+    for (char c : BINARY_SAVE_MAGIC)
+    {
+        out.u8(static_cast<std::uint8_t>(c));
+    }
+    out.u16(BINARY_SAVE_VERSION);
+    writeState(out);
+    logger.toBinary(out);
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("Impossible de créer le fichier de sauvegarde: " + filename); // 无法创建存档文件
+    }
+    file.write(out.data().data(), static_cast<std::streamsize>(out.data().size()));
+}
 
+// État de jeu au format binaire : tour, joueur courant, graine, générateur, réserve et joueurs
+//  二进制格式的游戏状态: 回合、当前玩家、种子、生成器、供应堆和玩家
+void Game::writeState(BinaryWriter &out) const
+{
+    out.i32(turnCount);
+    out.i32(currentPlayer);
+    out.u64(seed);
+    for (std::uint64_t word : rng.getState())
+    {
+        out.u64(word);
+    }
+    supply.toBinary(out);
+    out.u8(static_cast<std::uint8_t>(players.size()));
     for (const auto &player : players)
     {
-        int totalScore = 0;
-        auto allCards = player.getAllCards();
+        player.toBinary(out);
+    }
+}
 
-        // Calculer le score de la carte de points de victoire de base
-        //  计算基础胜利点数卡的分数
-        for (const auto &card : player.getAllCards())
-        {
-            totalScore += card->getVictoryPoints(); // Calculer le score total
-                                                    //  计算总分
-        }
+// Empreinte FNV-1a de l'état au format binaire : deux parties de même état ont la même empreinte
+//  二进制格式状态的 FNV-1a 哈希: 状态相同的两局哈希相同
+std::uint64_t Game::stateHash() const
+{
+    BinaryWriter out;
+    writeState(out);
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    for (char c : out.data())
+    {
+        hash = (hash ^ static_cast<std::uint8_t>(c)) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+// Charger une sauvegarde binaire, exception si la signature, la version ou le contenu est invalide
+//  加载二进制存档, 签名、版本或内容无效时抛出异常
+void Game::loadBinary(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("Impossible d'ouvrir le fichier de sauvegarde: " + filename); // 无法打开存档文件
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
 
-        // Calculer les points supplémentaires pour les cartes de jardin
-        //  计算花园牌的额外分数
-        int gardensCount = 0;
-        for (const auto &card : allCards)
+    try
+    {
+        BinaryReader in(data);
+        for (char c : BINARY_SAVE_MAGIC)
         {
-            if (card->getName() == "Gardens")
+            if (in.u8() != static_cast<std::uint8_t>(c))
             {
-                gardensCount++;
+                throw std::runtime_error("Ce n'est pas une sauvegarde binaire"); // 不是二进制存档
             }
         }
-        // 1 point pour 10 cartes × nombre de jardins
-        //  每10张牌1分 × 花园数量
-        int totalCards = allCards.size();
-        totalScore += (totalCards / 10) * gardensCount;
+        std::uint16_t version = in.u16();
+        if (version < 1 || version > BINARY_SAVE_VERSION)
+        {
+            throw std::runtime_error("Version de sauvegarde non prise en charge: " + std::to_string(version)); // 不支持的存档版本
+        }
+
+        turnCount = in.i32();
+        currentPlayer = in.i32();
+        seed = in.u64();
+        Random::State state;
+        for (auto &word : state)
+        {
+            word = in.u64();
+        }
+        rng.setState(state);
+        supply.fromBinary(in);
+
+        std::uint8_t playerCount = in.u8();
+        if (playerCount == 0 || currentPlayer < 0 || currentPlayer >= playerCount)
+        {
+            throw std::runtime_error("Joueurs invalides"); // 玩家无效
+        }
+        players.clear();
+        for (std::uint8_t i = 0; i < playerCount; i++)
+        {
+            Player player("", &memory->pool);
+            player.fromBinary(in);
+            player.setVerbose(verbose);
+            players.push_back(std::move(player));
+        }
+        logger.fromBinary(in, version);
+        syncLoggerPlayers();
+    }
+    catch (const std::exception &e)
+    {
+        throw std::runtime_error("Échec du chargement du jeu: " + std::string(e.what())); // 加载游戏失败
+    }
+}
+
+// Calculer le score final
+//  计算最终得分
+std::vector<std::pair<std::string, int>> Game::calculateFinalScores() const
+{
+    std::vector<std::pair<std::string, int>> scores;
+
+    for (const auto &player : players)
+    {
+        // Points tenus à jour par le joueur (Jardins compris), sans parcourir ses cartes
+        //  由玩家维护的点数(包括花园), 无需遍历其卡片
+        int totalScore = player.getVictoryPoints();
 
         scores.emplace_back(player.getName(), totalScore); // Ajouter le nom du joueur et le score total
                                                            //  添加玩家名和总分
@@ -932,11 +1395,11 @@ void Game::displayFinalState() const
     std::cout << "Nombre total de tours: " << turnCount << "\n";
     std::cout << "tas de provisions vide:\n";
 
-    for (const auto &[cardName, pile] : supply)
+    for (CardId id = 0; id < CardIds::COUNT; id++)
     {
-        if (pile.empty())
+        if (supply.contains(id) && supply.isEmpty(id))
         {
-            std::cout << "- " << cardName << "\n";
+            std::cout << "- " << Card::get(id).getName() << "\n";
         }
     }
     std::cout << "==================\n\n";
@@ -959,37 +1422,34 @@ void Game::displayStats()
     // Montre d'abord la carte au trésor de base
     //  按类型分组显示
     // 首先示基础财宝卡
-    for (const auto &[cardName, pile] : supply)
+    for (CardId id : {CardIds::COPPER, CardIds::SILVER, CardIds::GOLD})
     {
-        if (cardName == "Copper" || cardName == "Silver" || cardName == "Gold")
+        if (supply.contains(id))
         {
-            std::cout << std::setw(15) << cardName
-                      << std::setw(10) << pile.size() << "\n";
+            std::cout << std::setw(15) << Card::get(id).getName()
+                      << std::setw(10) << supply.count(id) << "\n";
         }
     }
 
     // Puis affichez la carte point de victoire et la carte malédiction
     //  然后显示胜利点数卡和诅咒卡
-    for (const auto &[cardName, pile] : supply)
+    for (CardId id : {CardIds::ESTATE, CardIds::DUCHY, CardIds::PROVINCE, CardIds::CURSE})
     {
-        if (cardName == "Estate" || cardName == "Duchy" ||
-            cardName == "Province" || cardName == "Curse")
+        if (supply.contains(id))
         {
-            std::cout << std::setw(15) << cardName
-                      << std::setw(10) << pile.size() << "\n";
+            std::cout << std::setw(15) << Card::get(id).getName()
+                      << std::setw(10) << supply.count(id) << "\n";
         }
     }
 
     // Affichez enfin la carte du royaume
     //  最后显示王国卡
-    for (const auto &[cardName, pile] : supply)
+    for (CardId id = CardIds::FIRST_KINGDOM; id < CardIds::COUNT; id++)
     {
-        if (cardName != "Copper" && cardName != "Silver" && cardName != "Gold" &&
-            cardName != "Estate" && cardName != "Duchy" &&
-            cardName != "Province" && cardName != "Curse")
+        if (supply.contains(id))
         {
-            std::cout << std::setw(15) << cardName
-                      << std::setw(10) << pile.size() << "\n";
+            std::cout << std::setw(15) << Card::get(id).getName()
+                      << std::setw(10) << supply.count(id) << "\n";
         }
     }
 
@@ -1028,18 +1488,20 @@ void Game::otherPlayersDiscardToThree(const Player &currentPlayer)
                 if (handSize > 3)
                 { // Le nombre de cartes en main est supérieur à 3
                   // 手牌数量大于3
-                    std::cout << "\n"
-                              << player.getName() << " Doit être jeté "
-                              << (handSize - 3) << " cartes\n";
-                    player.discardDownTo(3); // Jeter sur 3 cartes
-                                             //  弃牌到3张
+                    if (verbose)
+                        std::cout << "\n"
+                                  << player.getName() << " Doit être jeté "
+                                  << (handSize - 3) << " cartes\n";
+                    player.discardDownTo(3, *this); // Jeter sur 3 cartes
+                                                    //  弃牌到3张
                 }
             }
             else
             { // Avoir une défense contre les douves
               // 有护城河防御
-                std::cout << player.getName() << " Douves utilisées pour se défendre contre les attaques\n";
-                logger.logAction(player.getName(), "Douves utilisées pour se défendre contre les attaques");
+                if (verbose)
+                    std::cout << player.getName() << " Douves utilisées pour se défendre contre les attaques\n";
+                logEvent(GameEventKind::MOAT_BLOCKED, player, CardIds::MILITIA);
             }
         }
     }
@@ -1056,8 +1518,7 @@ void Game::otherPlayersDraw(const Player &currentPlayer, int count)
             // 不是当前玩家
             player.drawCard(count); // Les autres joueurs piochent des cartes
                                     //  其他玩家抽牌
-            logger.logAction(player.getName(),
-                             "Pioché " + std::to_string(count) + " cartes");
+            logEvent(GameEventKind::CARDS_DRAWN, player, CardIds::INVALID, count);
         }
     }
 }
@@ -1065,6 +1526,26 @@ void Game::otherPlayersDraw(const Player &currentPlayer, int count)
 // Obtenez une carte qui ne dépasse pas le coût maximum des pièces d'or
 //  获得一张卡片不超过maxCost金币的卡片
 void Game::gainCardUpToCost(Player &player, int maxCost)
+{
+    CardId choice = player.getDecisionProvider().chooseGain(player, *this, maxCost);
+
+    if (!supply.isEmpty(choice) && Card::get(choice).getCost() <= maxCost)
+    {
+        supply.take(choice);
+        player.gainCard(choice);
+        logEvent(GameEventKind::CARD_GAINED, player, choice);
+        if (verbose)
+            std::cout << "obtenu avec succès " << Card::get(choice).getName() << "!\n";
+    }
+    else if (verbose)
+    {
+        std::cout << "Impossible d'obtenir la carte\n";
+    }
+}
+
+// Afficher les cartes pouvant être obtenues (coût <= maxCost)
+//  显示可获得的卡片(花费 <= maxCost)
+void Game::displayGainableCards(int maxCost) const
 {
     std::cout << "\n=== obtenir une carte ===\n";
     std::cout << "Cartes disponibles (dépense maximale: " << maxCost << "):\n";
@@ -1076,58 +1557,70 @@ void Game::gainCardUpToCost(Player &player, int maxCost)
 
     // Afficher les cartes disponibles
     //  显示可获得的卡片
-    for (const auto &[cardName, pile] : supply)
+    for (CardId id = 0; id < CardIds::COUNT; id++)
     {
-        if (!pile.empty() && pile[0]->getCost() <= maxCost)
+        if (!supply.isEmpty(id) && Card::get(id).getCost() <= maxCost)
         {
-            std::cout << std::setw(15) << cardName
-                      << std::setw(10) << pile[0]->getCost()
-                      << std::setw(10) << pile.size() << "\n";
+            std::cout << std::setw(15) << Card::get(id).getName()
+                      << std::setw(10) << Card::get(id).getCost()
+                      << std::setw(10) << supply.count(id) << "\n";
         }
     }
     std::cout << std::string(40, '-') << "\n";
+}
 
-    std::cout << "\nVeuillez entrer le nom de la carte que vous souhaitez obtenir: ";
-    std::string input;
-    std::getline(std::cin, input);
-
-    auto it = std::find_if(supply.begin(), supply.end(),
-                           [&input](const auto &pair)
-                           {
-                               return Utils::equalIgnoreCase(pair.first, input);
-                           });
+// Définir la source des décisions d'un joueur
+//  设置玩家的决策来源
+void Game::setDecisionProvider(size_t playerIndex, std::shared_ptr<DecisionProvider> provider)
+{
+    players.at(playerIndex).setDecisionProvider(std::move(provider));
+}
 
-    if (it != supply.end() && !it->second.empty() &&
-        it->second[0]->getCost() <= maxCost)
+// Activer ou désactiver l'affichage console (partie et joueurs)
+//  开启或关闭控制台输出(游戏和玩家)
+void Game::setVerbose(bool value)
+{
+    verbose = value;
+    for (auto &player : players)
     {
-        std::shared_ptr<Card> gainedCard = it->second.back();
-        it->second.pop_back();
-        player.addToDiscard(gainedCard);
-        logger.logAction(player.getName(), "获得 " + it->first);
-        std::cout << "obtenu avec succès " << it->first << "!\n";
+        player.setVerbose(value);
     }
-    else
+}
+
+// Nombre de cartes restantes dans une pile de réserve (0 si absente)
+//  供应堆中剩余的卡片数量(不存在时为0)
+int Game::getSupplyCount(CardId cardId) const
+{
+    return supply.count(cardId);
+}
+
+// Transmettre les noms des joueurs au journal
+//  将玩家名称传给日志
+void Game::syncLoggerPlayers()
+{
+    logger.setPlayerCount(players.size());
+    for (size_t i = 0; i < players.size(); i++)
     {
-        std::cout << "Impossible d'obtenir la carte\n";
+        logger.setPlayerName(i, players[i].getName());
     }
 }
 
-// Enregistrer l'action (nom du joueur, action)
-//  记录行动(玩家名, 行动)
-void Game::logAction(const std::string &playerName, const std::string &action)
+// Enregistrer un événement (joueur, carte, quantité) au tour courant
+//  在当前回合记录事件(玩家, 卡片, 数量)
+void Game::logEvent(GameEventKind kind, const Player &player, CardId card, int amount)
 {
-    logger.logAction(playerName, action);
+    logger.logEvent(kind, static_cast<int>(&player - players.data()), turnCount, card, amount);
 }
 
 // Afficher la description de la carte de ravitaillement
 //  显示供应卡片的描述
 void Game::showSupplyCardDescription(const std::string &cardName) const
 {
-    auto it = supply.find(cardName);
-    if (it != supply.end() && !it->second.empty())
+    CardId id = Card::findId(cardName);
+    if (!supply.isEmpty(id))
     {
         std::cout << "\n"
-                  << it->second[0]->getDescription() << "\n";
+                  << Card::get(id).getDescription() << "\n";
     }
     else
     {
@@ -1149,14 +1642,13 @@ void Game::displaySupplyPiles() const
               << std::setw(10) << "dépenser | "
               << std::setw(10) << "Quantité restante" << "\n";
     std::cout << std::string(40, '-') << "\n";
-    const std::vector<std::string> treasureCards = {"Copper", "Silver", "Gold"};
-    for (const auto &cardName : treasureCards)
+    for (CardId id : {CardIds::COPPER, CardIds::SILVER, CardIds::GOLD})
     {
-        if (supply.count(cardName) && !supply.at(cardName).empty())
+        if (!supply.isEmpty(id))
         {
-            std::cout << std::setw(15) << cardName
-                      << std::setw(10) << supply.at(cardName)[0]->getCost()
-                      << std::setw(10) << supply.at(cardName).size() << "\n";
+            std::cout << std::setw(15) << Card::get(id).getName()
+                      << std::setw(10) << Card::get(id).getCost()
+                      << std::setw(10) << supply.count(id) << "\n";
         }
     }
 
@@ -1169,14 +1661,13 @@ void Game::displaySupplyPiles() const
               << std::setw(10) << "Quantité restante" << "\n";
     std::cout << std::string(40, '-') << "\n";
 
-    const std::vector<std::string> victoryCards = {"Estate", "Duchy", "Province"};
-    for (const auto &cardName : victoryCards)
+    for (CardId id : {CardIds::ESTATE, CardIds::DUCHY, CardIds::PROVINCE})
     {
-        if (supply.count(cardName) && !supply.at(cardName).empty())
+        if (!supply.isEmpty(id))
         {
-            std::cout << std::setw(15) << cardName
-                      << std::setw(10) << supply.at(cardName)[0]->getCost()
-                      << std::setw(10) << supply.at(cardName).size() << "\n";
+            std::cout << std::setw(15) << Card::get(id).getName()
+                      << std::setw(10) << Card::get(id).getCost()
+                      << std::setw(10) << supply.count(id) << "\n";
         }
     }
 
@@ -1189,11 +1680,11 @@ void Game::displaySupplyPiles() const
               << std::setw(10) << "Quantité restante" << "\n";
     std::cout << std::string(40, '-') << "\n";
 
-    if (supply.count("Curse") && !supply.at("Curse").empty())
+    if (!supply.isEmpty(CardIds::CURSE))
     {
         std::cout << std::setw(15) << "Curse"
-                  << std::setw(10) << supply.at("Curse")[0]->getCost()
-                  << std::setw(10) << supply.at("Curse").size() << "\n";
+                  << std::setw(10) << Card::get(CardIds::CURSE).getCost()
+                  << std::setw(10) << supply.count(CardIds::CURSE) << "\n";
     }
 
     // afficher la carte d'action
@@ -1205,18 +1696,15 @@ void Game::displaySupplyPiles() const
               << std::setw(10) << "Quantité restante" << "\n";
     std::cout << std::string(40, '-') << "\n";
 
-    for (const auto &[cardName, pile] : supply)
+    // Si ce n'est pas une carte de base ou une carte malédiction, c'est une carte action
+    //  如果不是基础卡或诅咒卡，就是行动卡
+    for (CardId id = CardIds::FIRST_KINGDOM; id < CardIds::COUNT; id++)
     {
-        // Si ce n'est pas une carte de base ou une carte malédiction, c'est une carte action
-        //  如果不是基础卡或诅咒卡，就是行动卡
-        if (!pile.empty() &&
-            std::find(treasureCards.begin(), treasureCards.end(), cardName) == treasureCards.end() &&
-            std::find(victoryCards.begin(), victoryCards.end(), cardName) == victoryCards.end() &&
-            cardName != "Curse")
+        if (!supply.isEmpty(id))
         {
-            std::cout << std::setw(15) << cardName
-                      << std::setw(10) << pile[0]->getCost()
-                      << std::setw(10) << pile.size() << "\n";
+            std::cout << std::setw(15) << Card::get(id).getName()
+                      << std::setw(10) << Card::get(id).getCost()
+                      << std::setw(10) << supply.count(id) << "\n";
         }
     }
     std::cout << std::string(40, '-') << "\n";
@@ -1236,16 +1724,15 @@ void Game::otherPlayersGainCurse(const Player &currentPlayer)
             {
                 // Vérifie s'il y a encore des cartes dans le paquet malédiction
                 //  检查诅咒牌堆是否还有牌
-                if (!supply["Curse"].empty())
+                if (supply.take(CardIds::CURSE))
                 {
-                    player.addToDiscard(supply["Curse"].back());
-                    supply["Curse"].pop_back();
-                    logger.logAction(player.getName(), "J'ai une carte de malédiction");
+                    player.gainCard(CardIds::CURSE);
+                    logEvent(GameEventKind::CURSE_GAINED, player, CardIds::CURSE);
                 }
             }
             else
             {
-                logger.logAction(player.getName(), "Douves utilisées pour se défendre contre l'effet de la sorcière");
+                logEvent(GameEventKind::MOAT_BLOCKED, player, CardIds::WITCH);
             }
         }
     }
@@ -1263,57 +1750,56 @@ void Game::resolveThiefEffect(Player &currentPlayer)
             {
                 // Vérifiez les deux premières cartes du jeu
                 //  查看牌库顶的两张牌
-                std::vector<std::shared_ptr<Card>> revealedCards;
+                std::vector<CardId> revealedCards;
                 auto &playerDeck = player.getDeck();
 
                 for (int i = 0; i < 2 && !playerDeck.empty(); i++)
                 {
-                    revealedCards.push_back(playerDeck.back());
-                    playerDeck.pop_back();
+                    revealedCards.push_back(playerDeck.draw(player.getRandom()));
                 }
 
                 // Afficher la carte révélée
                 //  显示被揭示的牌
-                std::cout << player.getName() << " carte révélée: ";
-                for (const auto &card : revealedCards)
+                if (verbose)
                 {
-                    std::cout << card->getName() << " ";
+                    std::cout << player.getName() << " carte révélée: ";
+                    for (CardId card : revealedCards)
+                    {
+                        std::cout << Card::get(card).getName() << " ";
+                    }
+                    std::cout << "\n";
                 }
-                std::cout << "\n";
 
                 // Trouver la carte au trésor
                 //  找出财宝牌
-                std::vector<std::shared_ptr<Card>> treasures;
+                std::vector<CardId> treasures;
                 std::copy_if(revealedCards.begin(), revealedCards.end(),
                              std::back_inserter(treasures),
-                             [](const auto &card)
-                             { return card->getType() == CardType::TREASURE; });
+                             [](CardId card)
+                             { return Card::get(card).getType() == CardType::TREASURE; });
 
                 // S'il y a une carte trésor, laissez le joueur actuel en choisir une
                 //  如果有财宝牌，让当前玩家选择一张
                 if (!treasures.empty())
                 {
-                    std::cout << "Sélectionnez la carte au trésor que vous souhaitez obtenir (entrez le numéro):\n";
-                    for (size_t i = 0; i < treasures.size(); i++)
-                    {
-                        std::cout << i + 1 << ". " << treasures[i]->getName() << "\n";
-                    }
+                    int choice = currentPlayer.getDecisionProvider().chooseThiefTreasure(currentPlayer, *this, player, treasures);
 
-                    int choice;
-                    std::cin >> choice;
-                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-                    if (choice > 0 && choice <= treasures.size())
+                    if (choice >= 0 && choice < static_cast<int>(treasures.size()))
                     {
-                        currentPlayer.addToDiscard(treasures[choice - 1]);
-                        logger.logAction(currentPlayer.getName(),
-                                         " a obtenu " + treasures[choice - 1]->getName() + "de " + player.getName());
+                        // Le trésor pris change de propriétaire : il ne retourne pas dans la défausse de la victime
+                        //  被拿走的财宝换了主人: 不再回到受害者的弃牌堆
+                        CardId stolen = treasures[choice];
+                        revealedCards.erase(std::find(revealedCards.begin(), revealedCards.end(), stolen));
+                        player.loseCard(stolen);
+                        currentPlayer.gainCard(stolen);
+                        logEvent(GameEventKind::CARD_STOLEN, currentPlayer, stolen,
+                                 static_cast<int>(&player - players.data()));
                     }
                 }
 
                 // Mettez les cartes restantes dans la pile de défausse
                 //  其余的牌放入弃牌堆
-                for (const auto &card : revealedCards)
+                for (CardId card : revealedCards)
                 {
                     player.addToDiscard(card);
                 }
@@ -1329,27 +1815,18 @@ void Game::resolveChapelEffect(Player &currentPlayer)
     int trashCount = 0;
     while (trashCount < 4 && !currentPlayer.getHand().empty())
     {
-        std::cout << "Main actuelle:\n";
         const auto &hand = currentPlayer.getHand();
-        for (size_t i = 0; i < hand.size(); i++)
-        {
-            std::cout << i + 1 << ". " << hand[i]->getName() << "\n";
-        }
-
-        std::cout << "Sélectionnez la carte à rubuter (entrez 0 pour terminer): ";
-        int choice;
-        std::cin >> choice;
-        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        int choice = currentPlayer.getDecisionProvider().chooseTrash(currentPlayer, *this);
 
-        if (choice == 0)
+        if (choice < 0)
             break;
 
-        if (choice > 0 && choice <= hand.size())
+        if (choice < static_cast<int>(hand.size()))
         {
-            std::string cardName = hand[choice - 1]->getName();
-            currentPlayer.trashCardFromHand(choice - 1);
+            CardId trashed = hand[choice];
+            currentPlayer.trashCardFromHand(choice);
             trashCount++;
-            logger.logAction(currentPlayer.getName(), "a rubuté " + cardName);
+            logEvent(GameEventKind::CARD_TRASHED, currentPlayer, trashed);
         }
     }
 }
@@ -1358,8 +1835,7 @@ void Game::resolveChapelEffect(Player &currentPlayer)
 //  计算花园的得分(每10张牌价值1分)
 int Game::calculateGardensPoints(const Player &player) const
 {
-    int totalCards = player.getAllCards().size();
-    return totalCards / 10; // Toutes les 10 cartes valent 1 point
+    return player.getCardCount() / 10; // Toutes les 10 cartes valent 1 point
                             //  每10张牌价值1分
 }
 
@@ -1367,9 +1843,9 @@ int Game::calculateGardensPoints(const Player &player) const
 //  显示王国卡的详细信息
 void Game::displayKingdomCardInfo(const std::string &cardName) const
 {
-    auto card = Card::createCard(cardName);
+    const Card &card = Card::get(Card::idOf(cardName));
     Utils::printDivider();
-    std::cout << card->getDescription() << "\n";
+    std::cout << card.getDescription() << "\n";
     Utils::printDivider();
 }
 
@@ -1531,9 +2007,9 @@ std::vector<std::string> Game::getRandomKingdomCards(int count)
         {
             try
             {
-                // Test si la carte peut être créée
-                //  测试是否可以创建卡片
-                Card::createCard(cardName);
+                // Test si la carte est enregistrée
+                //  测试卡片是否已注册
+                Card::idOf(cardName);
                 availableCards.push_back(cardName);
             }
             catch (...)
@@ -1547,9 +2023,7 @@ std::vector<std::string> Game::getRandomKingdomCards(int count)
             throw std::runtime_error("Nombre insuffisant de cartes du Royaume disponibles");
         }
 
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::shuffle(availableCards.begin(), availableCards.end(), gen);
+        rng.shuffle(availableCards.begin(), availableCards.end());
         availableCards.resize(count);
         return availableCards;
     }
@@ -1578,11 +2052,7 @@ void Game::initializeKingdomCards(const std::vector<std::string> &selectedCards)
     std::cout << "\nCarte du Royaume au choix :\n";
     for (const auto &cardName : selectedCards)
     {
-        supply[cardName] = std::vector<std::shared_ptr<Card>>();
-        for (int i = 0; i < 10; i++)
-        {
-            supply[cardName].push_back(Card::createCard(cardName));
-        }
+        supply.setPile(Card::idOf(cardName), 10);
         std::cout << "- " << cardName << " (10 cartes)\n";
     }
 }
@@ -1618,14 +2088,12 @@ void Game::displaySupplyStatus() const
     //  显示基础卡
     std::cout << "Carte de base:\n";
     Utils::printDivider('-', 30);
-    for (const auto &[cardName, pile] : supply)
+    for (CardId id = 0; id < CardIds::FIRST_KINGDOM; id++)
     {
-        if (cardName == "Copper" || cardName == "Silver" || cardName == "Gold" ||
-            cardName == "Estate" || cardName == "Duchy" || cardName == "Province" ||
-            cardName == "Curse")
+        if (supply.contains(id))
         {
-            std::cout << std::setw(15) << cardName
-                      << std::setw(5) << pile.size() << " cartes\n";
+            std::cout << std::setw(15) << Card::get(id).getName()
+                      << std::setw(5) << supply.count(id) << " cartes\n";
         }
     }
 
@@ -1633,14 +2101,12 @@ void Game::displaySupplyStatus() const
     //  显示王国卡
     std::cout << "\nCarte nRoyaume:\n";
     Utils::printDivider('-', 30);
-    for (const auto &[cardName, pile] : supply)
+    for (CardId id = CardIds::FIRST_KINGDOM; id < CardIds::COUNT; id++)
     {
-        if (cardName != "Copper" && cardName != "Silver" && cardName != "Gold" &&
-            cardName != "Estate" && cardName != "Duchy" && cardName != "Province" &&
-            cardName != "Curse")
+        if (supply.contains(id))
         {
-            std::cout << std::setw(15) << cardName
-                      << std::setw(5) << pile.size() << " cartes\n";
+            std::cout << std::setw(15) << Card::get(id).getName()
+                      << std::setw(5) << supply.count(id) << " cartes\n";
         }
     }
 }
@@ -1686,29 +2152,35 @@ std::string Game::getKingdomCardSetName() const
 {
     // Détermine le nom de la combinaison en fonction de la Kingdom Card actuellement utilisée
     //  根据当前使用的王国卡判断套装名称
-    std::vector<std::string> currentKingdomCards;
-    for (const auto &[cardName, pile] : supply)
+    // Parcours par identifiant croissant : la liste est déjà triée
+    //  按标识递增遍历: 列表已排好序
+    std::vector<CardId> currentKingdomCards;
+    for (CardId id = CardIds::FIRST_KINGDOM; id < CardIds::COUNT; id++)
     {
-        if (cardName != "Copper" && cardName != "Silver" && cardName != "Gold" &&
-            cardName != "Estate" && cardName != "Duchy" && cardName != "Province" &&
-            cardName != "Curse")
+        if (supply.contains(id))
         {
-            currentKingdomCards.push_back(cardName);
+            currentKingdomCards.push_back(id);
         }
     }
 
+    // Identifiants triés d'un ensemble prédéfini
+    //  预设套装的已排序标识
+    auto sortedIds = [](std::vector<CardId> ids)
+    {
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+
     // Vérifiez s'il correspond à l'ensemble par défaut
     //  检查是否匹配预设套装
-    if (currentKingdomCards == std::vector<std::string>{
-                                   "Village", "Cellar", "Moat", "Woodcutter", "Workshop",
-                                   "Militia", "Market", "Smithy", "CouncilRoom", "Laboratory"})
+    if (currentKingdomCards == sortedIds({CardIds::VILLAGE, CardIds::CELLAR, CardIds::MOAT, CardIds::WOODCUTTER, CardIds::WORKSHOP,
+                                          CardIds::MILITIA, CardIds::MARKET, CardIds::SMITHY, CardIds::COUNCIL_ROOM, CardIds::LABORATORY}))
     {
         return "Pack débutant";
     }
 
-    if (currentKingdomCards == std::vector<std::string>{
-                                   "Village", "Chapel", "Witch", "Gardens", "Laboratory",
-                                   "Market", "Smithy", "Militia", "Moneylender", "Thief"})
+    if (currentKingdomCards == sortedIds({CardIds::VILLAGE, CardIds::CHAPEL, CardIds::WITCH, CardIds::GARDENS, CardIds::LABORATORY,
+                                          CardIds::MARKET, CardIds::SMITHY, CardIds::MILITIA, CardIds::MONEYLENDER, CardIds::THIEF}))
     {
         return "Pack avancé";
     }
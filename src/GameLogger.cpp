@@ -1,42 +1,295 @@
 #include "GameLogger.h"
+#include <filesystem>
 #include <iomanip>
+#include <stdexcept>
+#include "BinaryIO.h"
 
-// Fonction : Enregistrer les actions du joueur -utilisé pour enregistrer les actions du joueur
-//  作用: 记录玩家动作 - 用于记录玩家动作
-void GameLogger::logAction(const std::string &playerName, const std::string &action)
+// Fichier du journal en flux
+//  流式日志文件
+
+void LogStream::open(const std::string &name, std::uint64_t resumeAt)
+{
+    close();
+    std::error_code error;
+    std::uint64_t size = std::filesystem::exists(name, error) ? std::filesystem::file_size(name, error) : 0;
+    if (error)
+    {
+        size = 0;
+    }
+    auto out = std::make_unique<std::ofstream>(name, std::ios::binary | std::ios::app);
+    if (!*out)
+    {
+        throw std::runtime_error("Impossible d'ouvrir le fichier du journal: " + name); // 无法打开日志文件
+    }
+    filename = name;
+    offset = size;
+    file = std::move(out);
+    // Le journal est en ajout seul : ce qui a été écrit après la sauvegarde reste, la reprise est signalée
+    //  日志只追加: 存档之后写入的内容保留, 并标记恢复的位置
+    if (resumeAt != APPEND && resumeAt != size)
+    {
+        write("=== Reprise d'une sauvegarde (position " + std::to_string(resumeAt) + " du journal) ===\n");
+    }
+}
+
+void LogStream::close()
+{
+    file.reset();
+    filename.clear();
+    offset = 0;
+}
+
+void LogStream::write(const std::string &block)
+{
+    file->write(block.data(), static_cast<std::streamsize>(block.size()));
+    file->flush();
+    if (!*file)
+    {
+        throw std::runtime_error("Impossible d'écrire dans le fichier du journal: " + filename); // 无法写入日志文件
+    }
+    offset += block.size();
+}
+
+GameLogger::~GameLogger()
+{
+    if (!stream.isOpen())
+        return;
+    try
+    {
+        flush();
+    }
+    catch (const std::exception &)
+    {
+        // Pas d'exception depuis un destructeur : les dernières lignes sont perdues
+        //  析构函数不能抛出异常: 最后的行丢失
+    }
+}
+
+void GameLogger::reset()
+{
+    flush();
+    history.clear();
+    events.clear();
+    textCount = 0;
+    cardsBought.fill(0);
+    cardsPlayed.fill(0);
+    startTime = std::time(nullptr);
+}
+
+void GameLogger::setCapacity(std::size_t maxEvents)
+{
+    capacity = maxEvents;
+    if (capacity != 0 && events.size() >= capacity)
+        spill();
+}
+
+// Fonction : Envoyer le journal dans un fichier -ce qui est déjà en mémoire y est écrit aussitôt
+//  作用: 将日志写入文件 - 内存中已有的内容立即写入
+void GameLogger::streamTo(const std::string &filename)
+{
+    if (!enabled)
+        return;
+    flush();
+    stream.close();
+    if (filename.empty())
+        return;
+    stream.open(filename);
+    if (capacity == 0)
+        capacity = DEFAULT_STREAM_CAPACITY;
+    flush();
+}
+
+void GameLogger::flush()
+{
+    if (stream.isOpen() && (!history.empty() || !events.empty()))
+        spill();
+}
+
+// Fonction : Vider la mémoire du journal -en flux, tout est écrit dans le fichier ; sinon anneau :
+// les lignes reprises d'une sauvegarde et la moitié la plus ancienne des événements sont oubliées
+//  作用: 清空日志内存 - 流式时全部写入文件; 否则为环形缓冲:
+//  丢弃从存档恢复的行和较旧的一半事件
+void GameLogger::spill()
+{
+    if (stream.isOpen())
+    {
+        std::string block;
+        for (const auto &line : history)
+        {
+            block += line;
+            block += '\n';
+        }
+        for (const auto &event : events)
+        {
+            block += render(event);
+            block += '\n';
+        }
+        stream.write(block);
+        history.clear();
+        events.clear();
+        textCount = 0;
+        return;
+    }
+
+    // Les textes libres gardés sont ramenés au début dans l'ordre et renumérotés
+    //  保留的自由文本按顺序移到开头并重新编号
+    history.clear();
+    std::size_t first = events.size() - capacity / 2;
+    std::size_t keptTexts = 0;
+    for (std::size_t i = first; i < events.size(); i++)
+    {
+        GameEvent event = events[i];
+        if (event.kind == GameEventKind::TEXT)
+        {
+            std::swap(texts[keptTexts], texts[event.amount]);
+            event.amount = static_cast<std::int16_t>(keptTexts++);
+        }
+        events[i - first] = event;
+    }
+    events.resize(events.size() - first);
+    textCount = keptTexts;
+}
+
+std::pmr::string &GameLogger::nextText()
+{
+    if (textCount == texts.size())
+        texts.emplace_back();
+    std::pmr::string &text = texts[textCount];
+    text.clear();
+    return text;
+}
+
+// Le texte est compté avant l'événement : si l'événement remplit la mémoire, il est déjà là pour être écrit
+//  先计入文本再记录事件: 如果事件使内存已满, 文本已经可以写出
+void GameLogger::commitText(int player, int turn)
 {
-    std::time_t now = std::time(nullptr);
-    char timeStr[20];
-    strftime(timeStr, sizeof(timeStr), "%H:%M:%S", localtime(&now));
-    logs.push_back(std::string(timeStr) + " - " + playerName + ": " + action);
+    int index = static_cast<int>(textCount++);
+    logEvent(GameEventKind::TEXT, player, turn, CardIds::INVALID, index);
 }
 
-// Fonction : Carte pour enregistrer les achats -Carte utilisée pour enregistrer les achats
-//  作用: 记录购买的卡片 - 用于记录购买的卡片
-void GameLogger::recordCardBought(const std::string &cardName)
+// Fonction : Enregistrer un texte libre -le texte est rangé à part, l'événement n'en garde que l'index
+//  作用: 记录自由文本 - 文本单独存放, 事件只保存其索引
+void GameLogger::logText(int player, int turn, const std::string &text)
 {
-    cardsBought[cardName]++;
+    if (!enabled)
+        return;
+    nextText().assign(text);
+    commitText(player, turn);
 }
 
-// Fonction : Enregistrer les cartes utilisées -Utilisé pour enregistrer les cartes utilisées
-//  作用: 记录使用过的卡片 - 用于记录使用过的卡片
-void GameLogger::recordCardPlayed(const std::string &cardName)
+// Fonction : Mettre un événement en forme -"Tour N - joueur: texte"
+//  作用: 格式化一个事件 - "回合 N - 玩家: 文本"
+std::string GameLogger::render(const GameEvent &event) const
 {
-    cardsPlayed[cardName]++;
+    std::string line = "Tour " + std::to_string(event.turn) + " - ";
+    if (event.player == SYSTEM_PLAYER)
+        line += "System";
+    else if (event.player < playerNames.size())
+        line += playerNames[event.player];
+    else
+        line += "Joueur " + std::to_string(event.player + 1);
+    line += ": ";
+
+    switch (event.kind)
+    {
+    case GameEventKind::TEXT:
+        line += std::string_view(texts.at(event.amount));
+        break;
+    case GameEventKind::CARD_PLAYED:
+        line += Card::get(event.card).describePlay(event.amount);
+        break;
+    case GameEventKind::CARD_BOUGHT:
+        line += "a acheté " + Card::get(event.card).getName() + " (coût: " + std::to_string(event.amount) + " pièces)";
+        break;
+    case GameEventKind::CARD_GAINED:
+        line += "a obtenu " + Card::get(event.card).getName();
+        break;
+    case GameEventKind::CARD_TRASHED:
+        line += "a écarté " + Card::get(event.card).getName();
+        break;
+    case GameEventKind::CARD_STOLEN:
+        line += "a obtenu " + Card::get(event.card).getName() + " de " +
+                (static_cast<std::size_t>(event.amount) < playerNames.size() ? playerNames[event.amount] : "?");
+        break;
+    case GameEventKind::CURSE_GAINED:
+        line += "J'ai une carte de malédiction";
+        break;
+    case GameEventKind::MOAT_BLOCKED:
+        line += event.card == CardIds::WITCH ? "Douves utilisées pour se défendre contre l'effet de la sorcière"
+                                             : "Douves utilisées pour se défendre contre les attaques";
+        break;
+    case GameEventKind::CARDS_DRAWN:
+        line += "Pioché " + std::to_string(event.amount) + " cartes";
+        break;
+    }
+    return line;
+}
+
+// Fonction : Journal mis en forme -lignes reprises d'une sauvegarde, puis événements
+//  作用: 格式化的日志 - 先是从存档恢复的行, 然后是事件
+std::vector<std::string> GameLogger::getLogs() const
+{
+    std::vector<std::string> lines;
+    lines.reserve(history.size() + events.size());
+    lines.insert(lines.end(), history.begin(), history.end());
+    for (const auto &event : events)
+    {
+        lines.push_back(render(event));
+    }
+    return lines;
+}
+
+// Compteurs par carte -> table nom/nombre (cartes jamais comptées omises)
+//  按卡片计数 -> 名称/数量表(省略从未计数的卡片)
+static std::map<std::string, int> countsByName(const std::array<int, CardIds::COUNT> &counts)
+{
+    std::map<std::string, int> byName;
+    for (CardId id = 0; id < CardIds::COUNT; id++)
+    {
+        if (counts[id] > 0)
+            byName[Card::get(id).getName()] = counts[id];
+    }
+    return byName;
+}
+
+// Table nom/nombre -> compteurs par carte (noms inconnus ignorés)
+//  名称/数量表 -> 按卡片计数(忽略未知名称)
+static void countsFromName(std::array<int, CardIds::COUNT> &counts, const std::map<std::string, int> &byName)
+{
+    counts.fill(0);
+    for (const auto &[cardName, count] : byName)
+    {
+        CardId id = Card::findId(cardName);
+        if (id != CardIds::INVALID)
+            counts[id] = count;
+    }
+}
+
+std::map<std::string, int> GameLogger::getCardsBought() const
+{
+    return countsByName(cardsBought);
+}
+
+std::map<std::string, int> GameLogger::getCardsPlayed() const
+{
+    return countsByName(cardsPlayed);
 }
 
 // Fonction : Enregistrer la carte du Royaume sélectionnée -Utilisé pour enregistrer la carte du Royaume sélectionnée
 //  作用: 记录选择的王国卡 - 用于记录选择的王国卡
 void GameLogger::logKingdomCardSelection(const std::vector<std::string> &cards)
 {
-    std::string cardList;
+    if (!enabled)
+        return;
+    std::pmr::string &text = nextText();
+    text += "Carte Royaume au choix: ";
     for (size_t i = 0; i < cards.size(); i++)
     {
         if (i > 0)
-            cardList += ", ";
-        cardList += cards[i];
+            text += ", ";
+        text += cards[i];
     }
-    logAction("System", "Carte Royaume au choix: " + cardList);
+    commitText(SYSTEM_PLAYER, 0);
 }
 
 // Fonction : Convertir les journaux au format JSON -Utilisé pour convertir les journaux au format JSON
@@ -46,11 +299,16 @@ json GameLogger::toJson() const
     json j;
     j["start_time"] = startTime;
     j["duration"] = std::time(nullptr) - startTime;
-    j["logs"] = logs;
+    j["logs"] = getLogs();
+    if (!stream.getFilename().empty())
+    {
+        j["log_file"] = stream.getFilename();
+        j["log_offset"] = stream.getOffset();
+    }
 
     json stats;
-    stats["cards_bought"] = cardsBought;
-    stats["cards_played"] = cardsPlayed;
+    stats["cards_bought"] = getCardsBought();
+    stats["cards_played"] = getCardsPlayed();
     j["statistics"] = stats;
 
     return j;
@@ -61,7 +319,92 @@ json GameLogger::toJson() const
 void GameLogger::fromJson(const json &j)
 {
     startTime = j["start_time"];
-    logs = j["logs"].get<std::vector<std::string>>();
-    cardsBought = j["statistics"]["cards_bought"].get<std::map<std::string, int>>();
-    cardsPlayed = j["statistics"]["cards_played"].get<std::map<std::string, int>>();
-}
\ No newline at end of file
+    // Les lignes sauvegardées sont déjà en forme : elles restent du texte
+    //  保存的行已经格式化: 保持为文本
+    history = j["logs"].get<std::vector<std::string>>();
+    events.clear();
+    textCount = 0;
+    countsFromName(cardsBought, j["statistics"]["cards_bought"].get<std::map<std::string, int>>());
+    countsFromName(cardsPlayed, j["statistics"]["cards_played"].get<std::map<std::string, int>>());
+
+    // Journal en flux : reprendre le fichier en ajout, les lignes sauvegardées y seront écrites ensuite
+    //  流式日志: 以追加方式继续写入文件, 保存的行随后写入文件
+    stream.close();
+    if (j.contains("log_file"))
+    {
+        stream.open(j["log_file"].get<std::string>(), j["log_offset"].get<std::uint64_t>());
+        if (capacity == 0)
+            capacity = DEFAULT_STREAM_CAPACITY;
+    }
+    if (capacity != 0 && history.size() > capacity)
+    {
+        if (stream.isOpen())
+            spill();
+        else
+            history.erase(history.begin(), history.end() - capacity);
+    }
+}
+
+// Fonction : Sauvegarde binaire -heure de début et statistiques, sans le texte du journal
+//  作用: 二进制存档 - 开始时间和统计信息, 不含日志文本
+void GameLogger::toBinary(BinaryWriter &out) const
+{
+    out.u64(static_cast<std::uint64_t>(startTime));
+    for (const auto &stats : {getCardsBought(), getCardsPlayed()})
+    {
+        out.u16(static_cast<std::uint16_t>(stats.size()));
+        for (const auto &[cardName, count] : stats)
+        {
+            out.str(cardName);
+            out.u32(static_cast<std::uint32_t>(count));
+        }
+    }
+
+    out.str(stream.getFilename());
+    if (stream.getFilename().empty())
+        return;
+    out.u64(stream.getOffset());
+    std::vector<std::string> pending = getLogs();
+    out.u32(static_cast<std::uint32_t>(pending.size()));
+    for (const auto &line : pending)
+    {
+        out.str(line);
+    }
+}
+
+// Fonction : Restaurer depuis la sauvegarde binaire (sans flux, le journal reprend vide)
+//  作用: 从二进制存档恢复(没有流时, 日志从空开始)
+void GameLogger::fromBinary(BinaryReader &in, std::uint16_t version)
+{
+    startTime = static_cast<std::time_t>(in.u64());
+    history.clear();
+    events.clear();
+    textCount = 0;
+    for (auto *stats : {&cardsBought, &cardsPlayed})
+    {
+        std::map<std::string, int> byName;
+        std::uint16_t size = in.u16();
+        for (std::uint16_t i = 0; i < size; i++)
+        {
+            std::string cardName = in.str();
+            byName[cardName] = static_cast<int>(in.u32());
+        }
+        countsFromName(*stats, byName);
+    }
+
+    stream.close();
+    if (version < 2)
+        return;
+    std::string filename = in.str();
+    if (filename.empty())
+        return;
+    std::uint64_t offset = in.u64();
+    std::uint32_t count = in.u32();
+    for (std::uint32_t i = 0; i < count; i++)
+    {
+        history.push_back(in.str());
+    }
+    stream.open(filename, offset);
+    if (capacity == 0)
+        capacity = DEFAULT_STREAM_CAPACITY;
+}
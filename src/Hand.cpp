@@ -0,0 +1,34 @@
+#include "Hand.h"
+#include <algorithm>
+
+// Retirer la carte à l'index donné et la renvoyer
+//  移除指定索引处的卡片并返回它
+CardId Hand::removeAt(std::size_t index)
+{
+    CardId card = cards[index];
+    cards.erase(cards.begin() + index);
+    uncounted(card);
+    return card;
+}
+
+// Retirer un exemplaire d'une carte : le compteur répond d'abord, la main n'est parcourue que si la carte y est
+//  移除一张某卡片: 先查计数, 只有卡片在手牌中时才遍历手牌
+bool Hand::remove(CardId card)
+{
+    if (!contains(card))
+    {
+        return false;
+    }
+    cards.erase(std::find(cards.begin(), cards.end(), card));
+    uncounted(card);
+    return true;
+}
+
+// Vider la main
+//  清空手牌
+void Hand::clear()
+{
+    cards.clear();
+    counts.fill(0);
+    present = 0;
+}
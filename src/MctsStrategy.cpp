@@ -0,0 +1,357 @@
+#include "MctsStrategy.h"
+#include "Player.h"
+#include "Random.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+// Totaux de toutes les instances (les recherches de plusieurs parties peuvent tourner en parallèle)
+//  所有实例的总计(多局的搜索可能并行运行)
+static std::atomic<long long> totalDecisions(0);
+static std::atomic<long long> totalPlayouts(0);
+static std::atomic<long long> totalMicroseconds(0);
+
+// Part de l'écart de points dans la récompense d'un playout, et écart (en points) considéré comme décisif
+//  分差在模拟收益中的占比, 以及被视为决定性的分差(点数)
+static constexpr double MARGIN_WEIGHT = 0.3;
+static constexpr double MARGIN_SCALE = 20.0;
+
+// Lire une spécification "mcts[:N|:Nms][/T]"
+//  解析 "mcts[:N|:Nms][/T]" 规格
+MctsConfig MctsConfig::fromSpec(const std::string &spec)
+{
+    MctsConfig config;
+    std::string rest = spec.substr(std::min<size_t>(spec.size(), 4));
+    try
+    {
+        size_t slash = rest.find('/');
+        if (slash != std::string::npos)
+        {
+            config.threads = std::stoi(rest.substr(slash + 1));
+            rest = rest.substr(0, slash);
+        }
+        if (!rest.empty())
+        {
+            if (rest[0] != ':')
+            {
+                throw std::invalid_argument(rest);
+            }
+            rest = rest.substr(1);
+            if (rest.size() > 2 && rest.compare(rest.size() - 2, 2, "ms") == 0)
+            {
+                config.timeLimitMs = std::stod(rest.substr(0, rest.size() - 2));
+                config.iterations = 0;
+            }
+            else
+            {
+                config.iterations = std::stoi(rest);
+            }
+        }
+    }
+    catch (const std::logic_error &)
+    {
+        throw std::runtime_error("Stratégie inconnue: " + spec); // 未知策略
+    }
+    if (config.threads < 1 || config.iterations < 0 || config.timeLimitMs < 0 ||
+        (config.iterations == 0 && config.timeLimitMs == 0))
+    {
+        throw std::runtime_error("Budget MCTS invalide: " + spec); // MCTS 预算无效
+    }
+    return config;
+}
+
+// Fournisseur des playouts : impose la première décision (l'option évaluée), puis suit la stratégie scriptée
+//  模拟用的决策提供者: 强制第一个决策(被评估的选项), 之后遵循脚本策略
+class ForcedFirstChoice : public DecisionProvider
+{
+private:
+    std::shared_ptr<DecisionProvider> rollout;
+    CardId forced;
+    bool pending;
+
+public:
+    explicit ForcedFirstChoice(std::shared_ptr<DecisionProvider> rollout)
+        : rollout(std::move(rollout)), forced(CardIds::INVALID), pending(false) {}
+
+    void force(CardId card)
+    {
+        forced = card;
+        pending = true;
+    }
+
+    CardId chooseAction(const Player &player, const Game &game) override
+    {
+        if (pending)
+        {
+            pending = false;
+            return forced;
+        }
+        return rollout->chooseAction(player, game);
+    }
+    CardId chooseBuy(const Player &player, const Game &game) override
+    {
+        if (pending)
+        {
+            pending = false;
+            return forced;
+        }
+        return rollout->chooseBuy(player, game);
+    }
+    CardId chooseGain(const Player &player, const Game &game, int maxCost) override
+    {
+        return rollout->chooseGain(player, game, maxCost);
+    }
+    int chooseDiscard(const Player &player, const Game &game) override
+    {
+        return rollout->chooseDiscard(player, game);
+    }
+    std::vector<int> chooseCellarDiscards(const Player &player, const Game &game) override
+    {
+        return rollout->chooseCellarDiscards(player, game);
+    }
+    int chooseTrash(const Player &player, const Game &game) override
+    {
+        return rollout->chooseTrash(player, game);
+    }
+    int chooseThiefTreasure(const Player &player, const Game &game, const Player &victim,
+                            const std::vector<CardId> &treasures) override
+    {
+        return rollout->chooseThiefTreasure(player, game, victim, treasures);
+    }
+};
+
+// Visites et gains cumulés de chaque option de la racine
+//  根节点每个选项的访问次数和累计收益
+struct RootStats
+{
+    std::vector<long long> visits;
+    std::vector<double> rewards;
+
+    explicit RootStats(size_t count) : visits(count, 0), rewards(count, 0) {}
+};
+
+// Résultat d'un playout pour l'observateur, entre 0 et 1 :
+// victoire (1, 1/k à égalité entre k joueurs, 0 sinon) complétée par l'écart de points avec le meilleur adversaire,
+// pour que les options restent départagées quand la partie semble perdue (ou gagnée) dans tous les cas
+//  一次模拟对观察者的结果, 介于0和1之间:
+//  胜负(获胜为1, k名玩家平局为1/k, 否则为0), 加上与最强对手的分差,
+//  使得在各种情况下看起来都输(或都赢)时仍能区分选项
+static double playoutReward(const Game &game, int observer)
+{
+    const auto &players = game.getPlayers();
+    int own = players[observer].getVictoryPoints();
+    int bestOther = std::numeric_limits<int>::min();
+    int tied = 1;
+    for (size_t i = 0; i < players.size(); i++)
+    {
+        if (static_cast<int>(i) == observer)
+            continue;
+        int points = players[i].getVictoryPoints();
+        bestOther = std::max(bestOther, points);
+        if (points == own)
+            tied++;
+    }
+    double win = own > bestOther ? 1.0 : (own == bestOther ? 1.0 / tied : 0.0);
+    double margin = std::clamp((own - bestOther) / (2.0 * MARGIN_SCALE) + 0.5, 0.0, 1.0);
+    return (1 - MARGIN_WEIGHT) * win + MARGIN_WEIGHT * margin;
+}
+
+// Option suivante à évaluer : chaque option une fois, puis UCB1
+//  下一个要评估的选项: 每个选项先评估一次, 然后使用 UCB1
+static size_t selectOption(const RootStats &root, long long totalVisits, double exploration)
+{
+    size_t best = 0;
+    double bestScore = -1;
+    double logTotal = std::log(static_cast<double>(std::max<long long>(1, totalVisits)));
+    for (size_t i = 0; i < root.visits.size(); i++)
+    {
+        if (root.visits[i] == 0)
+        {
+            return i;
+        }
+        double mean = root.rewards[i] / root.visits[i];
+        double score = mean + exploration * std::sqrt(logTotal / root.visits[i]);
+        if (score > bestScore)
+        {
+            bestScore = score;
+            best = i;
+        }
+    }
+    return best;
+}
+
+MctsStrategy::MctsStrategy(MctsConfig config) : config(std::move(config))
+{
+    BotStrategies::create(this->config.rolloutStrategy); // Exception si la stratégie des playouts est inconnue
+                                                         //  模拟策略未知时抛出异常
+}
+
+// Phase d'action : passer ou jouer une des cartes action de la main
+//  行动阶段: 跳过或使用手牌中的一张行动卡
+CardId MctsStrategy::chooseAction(const Player &player, const Game &game)
+{
+    std::vector<CardId> candidates = {CardIds::INVALID};
+    for (CardId card : player.getHand())
+    {
+        if (Card::get(card).getType() == CardType::ACTION &&
+            std::find(candidates.begin(), candidates.end(), card) == candidates.end())
+        {
+            candidates.push_back(card);
+        }
+    }
+    return search(player, game, Game::TurnPhase::ACTION, candidates);
+}
+
+// Phase d'achat : terminer ou acheter une carte disponible et abordable (jamais de Malédiction)
+//  购买阶段: 结束或购买一张可获得且买得起的卡(从不购买诅咒)
+CardId MctsStrategy::chooseBuy(const Player &player, const Game &game)
+{
+    std::vector<CardId> candidates = {CardIds::INVALID};
+    for (CardId card = 0; card < CardIds::COUNT; card++)
+    {
+        if (card != CardIds::CURSE && game.getSupplyCount(card) > 0 &&
+            Card::get(card).getCost() <= player.getCoins())
+        {
+            candidates.push_back(card);
+        }
+    }
+    return search(player, game, Game::TurnPhase::BUY, candidates);
+}
+
+CardId MctsStrategy::pickCard(const Player &, const Game &game, int coins) const
+{
+    CardId card = pickVictory(game, coins);
+    return card != CardIds::INVALID ? card : pickTreasure(game, coins);
+}
+
+// Recherche : chaque thread joue ses playouts sur sa propre copie, puis les visites de la racine sont additionnées
+// L'option la plus visitée est choisie
+//  搜索: 每个线程在自己的副本上进行模拟, 然后把根节点的访问次数相加
+//  选择访问次数最多的选项
+CardId MctsStrategy::search(const Player &player, const Game &game, Game::TurnPhase phase,
+                            const std::vector<CardId> &candidates)
+{
+    if (candidates.size() == 1)
+    {
+        return candidates[0];
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                std::chrono::duration<double, std::milli>(config.timeLimitMs));
+    int observer = static_cast<int>(&player - game.getPlayers().data());
+    int threads = std::max(1, config.threads);
+
+    // Graine dérivée de la partie et du numéro de décision dans cette partie : même partie, mêmes choix
+    // (budget en playouts), quelles que soient les parties jouées avant par ce fournisseur
+    //  由对局和本局内的决策编号派生的种子: 同一局得到同样的选择(按模拟次数计预算时), 与该提供者之前进行过的对局无关
+    Random seeds(game.getSeed() ^ (static_cast<std::uint64_t>(gameDecisions) * 0x9E3779B97F4A7C15ull));
+
+    std::vector<RootStats> perThread(threads, RootStats(candidates.size()));
+    std::vector<std::uint64_t> threadSeeds(threads);
+    for (auto &threadSeed : threadSeeds)
+    {
+        threadSeed = seeds();
+    }
+
+    auto worker = [&](int index)
+    {
+        RootStats &root = perThread[index];
+        Random rng(threadSeeds[index]);
+        auto rollout = BotStrategies::create(config.rolloutStrategy);
+        auto forced = std::make_shared<ForcedFirstChoice>(rollout);
+        Game scratch = game.fork();
+
+        int budget = config.iterations / threads + (index < config.iterations % threads ? 1 : 0);
+        for (long long done = 0;; done++)
+        {
+            if (config.iterations > 0 && done >= budget)
+                break;
+            if (config.timeLimitMs > 0 && std::chrono::steady_clock::now() >= deadline)
+                break;
+
+            size_t option = selectOption(root, done, config.exploration);
+
+            scratch.copyStateFrom(game);
+            scratch.randomizeHiddenState(rng(), observer);
+            for (int seat = 0; seat < static_cast<int>(scratch.getPlayers().size()); seat++)
+            {
+                scratch.setDecisionProvider(seat, seat == observer ? std::static_pointer_cast<DecisionProvider>(forced) : rollout);
+            }
+            forced->force(candidates[option]);
+            scratch.finishTurn(phase);
+            scratch.runHeadless(scratch.getTurnCount() + config.rolloutTurns);
+
+            root.visits[option]++;
+            root.rewards[option] += playoutReward(scratch, observer);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int i = 1; i < threads; i++)
+    {
+        pool.emplace_back(worker, i);
+    }
+    worker(0);
+    for (auto &thread : pool)
+    {
+        thread.join();
+    }
+
+    // Fusionner les racines des threads
+    //  合并各线程的根节点
+    RootStats total(candidates.size());
+    long long playouts = 0;
+    for (const auto &root : perThread)
+    {
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            total.visits[i] += root.visits[i];
+            total.rewards[i] += root.rewards[i];
+            playouts += root.visits[i];
+        }
+    }
+    size_t best = 0;
+    for (size_t i = 1; i < candidates.size(); i++)
+    {
+        if (total.visits[i] > total.visits[best] ||
+            (total.visits[i] == total.visits[best] && total.rewards[i] > total.rewards[best]))
+        {
+            best = i;
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    stats.decisions++;
+    gameDecisions++;
+    stats.playouts += playouts;
+    stats.seconds += seconds;
+    totalDecisions += 1;
+    totalPlayouts += playouts;
+    totalMicroseconds += static_cast<long long>(seconds * 1e6);
+
+    if (game.isVerbose())
+    {
+        std::cout << "[MCTS] " << (candidates[best] == CardIds::INVALID ? "passer" : Card::get(candidates[best]).getName())
+                  << " (" << playouts << " playouts, " << static_cast<long long>(playouts / std::max(seconds, 1e-9))
+                  << " playouts/s)\n";
+    }
+    return candidates[best];
+}
+
+// Statistiques de toutes les instances
+//  所有实例的统计
+MctsStats MctsStrategy::totalStats()
+{
+    MctsStats total;
+    total.decisions = totalDecisions;
+    total.playouts = totalPlayouts;
+    total.seconds = totalMicroseconds / 1e6;
+    return total;
+}
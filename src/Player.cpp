@@ -3,15 +3,93 @@
 #include "AllCards.h"
 #include "BasicCards.h"
 #include "ActionCards.h"
+#include "TerminalDecisionProvider.h"
+#include "BinaryIO.h"
 #include <algorithm>
-#include <random>
 #include <iostream>
 #include <fstream>
 
 // Constructeur : Initialiser le nom du joueur, les points d'action, les points d'achat, les pièces d'or
 //  构造函数: 初始化玩家名称、行动点、购买点、金币
-Player::Player(const std::string &playerName) : name(playerName), actions(1), buys(1), coins(0)
+Player::Player(const std::string &playerName, std::pmr::memory_resource *memory)
+    : name(playerName), hand(memory), discard(memory), inPlay(memory), trash(memory), actions(1), buys(1), coins(0), playedCardTrashed(false),
+      decisions(std::make_shared<TerminalDecisionProvider>()), verbose(true),
+      totalCards(0), baseVictoryPoints(0)
 {
+    ownedCounts.fill(0);
+    hand.reserve(HAND_CAPACITY);
+    inPlay.reserve(IN_PLAY_CAPACITY);
+    discard.reserve(DISCARD_CAPACITY);
+}
+
+// Fonction : revenir à un joueur neuf -clear garde la capacité des vecteurs et du nom
+//  作用: 恢复为新玩家 - clear 保留向量和名称的容量
+void Player::reset(const std::string &playerName)
+{
+    name = playerName;
+    deck.clear();
+    hand.clear();
+    discard.clear();
+    inPlay.clear();
+    trash.clear();
+    actions = 1;
+    buys = 1;
+    coins = 0;
+    playedCardTrashed = false;
+    ownedCounts.fill(0);
+    totalCards = 0;
+    baseVictoryPoints = 0;
+}
+
+// Fonction : gagner une carte -elle va dans la défausse et compte désormais pour le joueur
+//  作用: 获得一张卡 - 放入弃牌堆并计入玩家拥有的卡
+void Player::gainCard(CardId card)
+{
+    discard.push_back(card);
+    ownedCounts[card]++;
+    totalCards++;
+    baseVictoryPoints += Card::get(card).getVictoryPoints();
+}
+
+// Fonction : retirer une carte des compteurs (écartée ou prise par un adversaire)
+//  作用: 从计数中移除一张卡(被废弃或被对手拿走)
+void Player::loseCard(CardId card)
+{
+    ownedCounts[card]--;
+    totalCards--;
+    baseVictoryPoints -= Card::get(card).getVictoryPoints();
+}
+
+// Fonction : recalculer les compteurs à partir de la pioche, la main, la défausse et les cartes en jeu
+//  作用: 根据牌堆、手牌、弃牌堆和场上的卡重新计算计数
+void Player::recountCards()
+{
+    ownedCounts.fill(0);
+    totalCards = 0;
+    baseVictoryPoints = 0;
+    for (const auto *zone : {&discard, &inPlay})
+    {
+        for (CardId card : *zone)
+        {
+            ownedCounts[card]++;
+            totalCards++;
+            baseVictoryPoints += Card::get(card).getVictoryPoints();
+        }
+    }
+    for (CardId card = 0; card < CardIds::COUNT; card++)
+    {
+        int held = deck.count(card) + hand.count(card);
+        ownedCounts[card] += held;
+        totalCards += held;
+        baseVictoryPoints += held * Card::get(card).getVictoryPoints();
+    }
+}
+
+// Fonction : points de victoire actuels -chaque Jardin vaut 1 point par tranche de 10 cartes
+//  作用: 当前胜利点数 - 每张花园每10张牌计1分
+int Player::getVictoryPoints() const
+{
+    return baseVictoryPoints + ownedCounts[CardIds::GARDENS] * (totalCards / 10);
 }
 
 // Fonction : piocher des cartes
@@ -32,25 +110,37 @@ void Player::drawCard(int count)
             //  弃牌堆洗牌后加入牌堆
             shuffleDeck();
         }
-        // Piochez une carte du paquet
-        //  从牌堆中抽取一张牌
-        hand.push_back(deck.back());
-        // Retirer la carte du jeu
-        //  从牌堆中移除该牌
-        deck.pop_back();
+        // Piochez une carte du paquet, tirée au hasard parmi les cartes restantes
+        //  从牌堆中抽取一张牌, 在剩余卡片中随机抽取
+        hand.add(deck.draw(rng));
     }
 }
 
-// Fonction : Mélanger
-//  作用: 洗牌
+// Fonction : Mélanger (générateur du joueur, reproductible à partir de la graine de la partie)
+// La pioche ne garde pas d'ordre : la défausse y est versée, le hasard intervient à chaque pioche
+//  作用: 洗牌(使用玩家的生成器, 可由对局种子重现)
+//  牌堆不保存顺序: 弃牌堆并入牌堆, 随机性在每次抽牌时体现
 void Player::shuffleDeck()
 {
-    deck.insert(deck.end(), discard.begin(), discard.end());
+    deck.addAll(discard);
     discard.clear();
+}
 
-    std::random_device rd;
-    std::mt19937 g(rd());
-    std::shuffle(deck.begin(), deck.end(), g);
+// Fonction : Remélanger l'information cachée -la main garde sa taille, son contenu est retiré de la pioche
+//  作用: 重新洗混隐藏信息 - 手牌数量不变, 内容从牌堆中重新抽取
+void Player::shuffleHidden(std::uint64_t seed, bool includeHand)
+{
+    rng.reseed(seed);
+    if (includeHand)
+    {
+        size_t handSize = hand.size();
+        deck.addAll(hand.getCards());
+        hand.clear();
+        for (size_t i = 0; i < handSize; i++)
+        {
+            hand.add(deck.draw(rng));
+        }
+    }
 }
 
 // Fonction : défausser les cartes
@@ -63,6 +153,11 @@ void Player::discardHand()
     // Main claire
     //  清空手牌
     hand.clear();
+
+    // Les cartes jouées ce tour rejoignent aussi la défausse
+    //  本回合使用过的卡也进入弃牌堆
+    discard.insert(discard.end(), inPlay.begin(), inPlay.end());
+    inPlay.clear();
 }
 
 // Fonction : Initialiser le deck du joueur
@@ -73,14 +168,8 @@ void Player::initializeDeck()
     {
         // Deck initial : 7 pièces de cuivre et 3 manoirs
         //  初始牌组：7张铜币和3张庄园
-        for (int i = 0; i < 7; i++)
-        {
-            deck.push_back(Card::createCard("Copper"));
-        }
-        for (int i = 0; i < 3; i++)
-        {
-            deck.push_back(Card::createCard("Estate"));
-        }
+        deck.add(CardIds::COPPER, 7);
+        deck.add(CardIds::ESTATE, 3);
         // mélanger
         //  洗牌
         shuffleDeck();
@@ -111,9 +200,9 @@ void Player::showDeckStatus() const
 void Player::showHand() const
 {
     std::cout << "Main: ";
-    for (const auto &card : hand)
+    for (CardId card : hand)
     {
-        std::cout << card->getName() << " ";
+        std::cout << Card::get(card).getName() << " ";
     }
     std::cout << "\n";
 }
@@ -122,9 +211,7 @@ void Player::showHand() const
 //  作用: 检查玩家是否有行动卡
 bool Player::hasActionCard() const
 {
-    return std::any_of(hand.begin(), hand.end(),
-                       [](const auto &card)
-                       { return card->getType() == CardType::ACTION; });
+    return hand.hasType(CardType::ACTION);
 }
 
 // Fonction : Exécuter la carte d'action
@@ -139,45 +226,33 @@ bool Player::hasActionCard() const
 //  使用卡片
 //  将使用过的卡片加入弃牌堆
 //  从手牌中移除该卡片
-bool Player::playAction(const std::string &cardName, Game &game)
+bool Player::playAction(CardId cardId, Game &game)
 {
     // Vérifiez s'il y a suffisamment de points d'action
     //  检查是否有足够的行动点
     if (actions <= 0)
     {
-        std::cout << "Pas assez de points d'action\n";
+        if (verbose)
+            std::cout << "Pas assez de points d'action\n";
         return false;
     }
 
-    // Rechercher des cartes
-    // itérateur -pointe vers l'élément trouvé
-    // std::find_if partira de hand.begin() et appellera tour à tour l'expression Lambda sur chaque carte :
-    // Appelez card->getName() pour obtenir le nom et effectuez une comparaison indépendante de la casse avec le nom cible cardName.
-    // Si Utils::equalIgnoreCase renvoie true, cela signifie qu'un élément répondant aux conditions est trouvé et la recherche s'arrête.
-    // Si aucun élément correspondant n'est trouvé, renvoie hand.end().
-    //  查找卡片
-    // 迭代器 - 指向查找到的元素
-    // std::find_if 会从 hand.begin() 开始，依次对每个 card 调用 Lambda 表达式：
-    // 调用 card->getName() 获取名称，与目标名称 cardName 进行大小写无关的比较。
-    // 如果 Utils::equalIgnoreCase 返回 true，表示找到了符合条件的元素，停止查找。
-    // 如果找不到符合条件的元素，则返回 hand.end()。
-    auto it = std::find_if(hand.begin(), hand.end(),
-                           [&cardName](const auto &card)
-                           {
-                               return Utils::equalIgnoreCase(card->getName(), cardName);
-                           });
+    // Rechercher des cartes : le compteur de la main répond en temps constant
+    //  查找卡片: 手牌计数以常数时间回答
     // Si la carte est introuvable
     //  如果找不到该卡片
-    if (it == hand.end())
+    if (!hand.contains(cardId))
     {
-        std::cout << "La carte est introuvable\n";
+        if (verbose)
+            std::cout << "La carte est introuvable\n";
         return false;
     }
     // Vérifiez s'il s'agit d'une carte action
     //  检查是否是行动卡
-    if ((*it)->getType() != CardType::ACTION)
+    if (Card::get(cardId).getType() != CardType::ACTION)
     {
-        std::cout << "Ceci n'est pas une carte d'action\n";
+        if (verbose)
+            std::cout << "Ceci n'est pas une carte d'action\n";
         return false;
     }
 
@@ -185,149 +260,117 @@ bool Player::playAction(const std::string &cardName, Game &game)
     //  使用卡片
     try
     {
-        (*it)->play(*this, game);
-        // Ajouter les cartes utilisées à la pile de défausse
-        //  将使用过的卡片加入弃牌堆
-        discard.push_back(*it);
-        // Retirez cette carte de la main
-        //  从手牌中移除该卡片
-        hand.erase(it);
+        // Retirez cette carte de la main avant l'effet (l'effet peut modifier la main)
+        //  在执行效果前从手牌中移除该卡片(效果可能修改手牌)
+        hand.remove(cardId);
+        playedCardTrashed = false;
+        if (isVanilla(cardId))
+        {
+            // Carte sans choix : effets fixes de la table, sans appel virtuel
+            //  没有选择的卡片: 表中的固定效果, 无虚函数调用
+            applyEffect(CARD_EFFECTS[cardId]);
+            game.logEvent(GameEventKind::CARD_PLAYED, *this, cardId);
+        }
+        else
+        {
+            Card::get(cardId).play(*this, game);
+        }
+        // Mettre la carte utilisée en jeu jusqu'au nettoyage (sauf si elle a été écartée)
+        // Elle ne peut donc pas être repiochée par son propre effet dans ce tour
+        //  将使用过的卡片放入场上直到清理阶段(除非已被废弃)
+        //  因此本回合内不会被自身效果重新抽到
+        if (!playedCardTrashed)
+        {
+            inPlay.push_back(cardId);
+        }
         return true;
     }
     // Une erreur se produit lors de l'utilisation de la carte, interceptez l'exception
     //  使用卡片时发生错误, 捕获异常
     catch (const std::exception &e)
     {
-        std::cout << "Une erreur s'est produite lors de l'utilisation de la carte: " << e.what() << "\n";
+        if (verbose)
+            std::cout << "Une erreur s'est produite lors de l'utilisation de la carte: " << e.what() << "\n";
         return false;
     }
 }
 
 // Fonction : Exécuter la carte de richesse
 //  作用: 执行财富卡
-bool Player::playTreasure(const std::string &cardName)
+bool Player::playTreasure(CardId cardId)
 {
-    // itérateur -pointe vers l'élément trouvé
-    //  迭代器 - 指向查找到的元素
-    auto it = std::find_if(hand.begin(), hand.end(),
-                           [&cardName](const auto &card)
-                           { return card->getName() == cardName; });
     // Si la carte est introuvable
     //  如果找不到该卡片
-    if (it == hand.end())
+    if (!hand.contains(cardId))
     {
         return false;
     }
     // Vérifiez s'il s'agit d'une carte de richesse
     //  检查是否是财富卡
-    if ((*it)->getType() != CardType::TREASURE)
+    if (Card::get(cardId).getType() != CardType::TREASURE)
     {
         return false;
     }
 
-    // Créer un objet de jeu temporaire car les cartes de richesse n'utilisent pas l'état du jeu
-    //  创建一个临时Game对象，因为财富卡不使用游戏状态
-    static Game dummyGame(0); // Utilisez des objets statiques pour éviter les créations répétées
-                              //  使用静态对象避免重复创建
-    (*it)->play(*this, dummyGame);
-    // Ajouter les cartes utilisées à la pile de défausse
-    //  将使用过的卡片加入弃牌堆
-    discard.push_back(*it);
+    // Les trésors n'ont que des effets fixes : aucun objet Game n'est nécessaire
+    //  财宝卡只有固定效果: 不需要 Game 对象
+    applyEffect(CARD_EFFECTS[cardId]);
+    // Mettre la carte utilisée en jeu
+    //  将使用过的卡片放到场上
+    inPlay.push_back(cardId);
     // Retirez cette carte de la main
     //  从手牌中移除该卡片
-    hand.erase(it);
+    hand.remove(cardId);
     return true;
 }
 
-// Fonction : Obtenez les cartes de richesse dans la main du joueur -utilisé pour utiliser automatiquement toutes les cartes de richesse
-// Parcourez les cartes à main et ajoutez la carte de richesse au conteneur
-//  作用: 获取玩家手牌中的财富卡 - 用于自动使用所有财富卡
-//  遍历手牌，将财富卡加入容器
-std::vector<std::shared_ptr<Card>> Player::getTreasureCards() const
-{
-    std::vector<std::shared_ptr<Card>> treasures; // Conteneur pour stocker les cartes de richesse
-                                                  //  存储财富卡的容器
-    for (const auto &card : hand)
-    {
-        if (card->getType() == CardType::TREASURE)
-        {
-            treasures.push_back(card);
-        }
-    }
-    return treasures;
-}
-
 // Afficher automatiquement toutes les cartes de richesse en main pour faciliter l'affichage des montants numériques
+// Un seul passage : les pièces sont additionnées, les trésors passent en jeu dans l'ordre de la main
+// et les autres cartes sont tassées sur place (aucune allocation une fois la zone en jeu dimensionnée)
 //  自动展示手牌中所有财富卡, 以方便数字金额的显示
+//  一次遍历: 累加金币, 财宝按手牌顺序放到场上,
+//  其他卡片就地压紧(场上区域容量足够后无内存分配)
 void Player::playAllTreasures()
 {
-    std::cout << "\nUtilisation automatique de toutes les cartes Trésor  :\n";
+    if (verbose)
+        std::cout << "\nUtilisation automatique de toutes les cartes Trésor  :\n";
 
-    auto treasures = getTreasureCards();
-    if (!treasures.empty())
-    {
-        for (const auto &card : treasures)
-        {
-            // Supprimer de la main
-            //  从手牌中移除
-            auto it = std::find(hand.begin(), hand.end(), card);
-            if (it != hand.end())
-            {
-                // utilise la carte
-                //  使用卡片
-                card->play(*this, *static_cast<Game *>(nullptr)); // Modifier ceci pour supprimer le code qui crée un nouveau jeu
-                                                                  //  修改这里，移除创建新游戏的代码
-
-                // Déplacement vers la pile de défausse
-                //  移到弃牌堆
-                discard.push_back(*it);
-                hand.erase(it);
-
-                std::cout << "utilisé " << card->getName() << " (+";
-                if (card->getName() == "Copper")
-                    std::cout << "1";
-                else if (card->getName() == "Silver")
-                    std::cout << "2";
-                else if (card->getName() == "Gold")
-                    std::cout << "3";
-                std::cout << " pièces)\n";
-            }
-        }
+    bool played = false;
+    hand.removeIf([&](CardId card)
+                  {
+                      const Card &treasure = Card::get(card);
+                      if (treasure.getType() != CardType::TREASURE)
+                          return false;
 
+                      coins += treasure.getCoinValue();
+                      inPlay.push_back(card);
+                      played = true;
+
+                      if (verbose)
+                          std::cout << "utilisé " << treasure.getName() << " (+" << treasure.getCoinValue() << " pièces)\n";
+                      return true; });
+
+    if (played && verbose)
         std::cout << "Total actuel des pièces : " << coins << "\n";
-    }
 }
 
 // Fonction : Vérifier si le joueur possède des douves-douves-douves
 //  作用: 检查玩家是否有护城河-douves-moat
 bool Player::hasMoat() const
 {
-    // Parcourez les cartes en main et vérifiez s'il y a un fossé
-    //  遍历手牌，检查是否有护城河
-    for (const auto &card : hand)
-    {
-        if (card->getName() == "Moat")
-        {
-            return true;
-        }
-    }
-    return false;
+    // Compteur de la main : pas de parcours
+    //  手牌计数: 无需遍历
+    return hand.contains(CardIds::MOAT);
 }
 
 // Fonction : Supprimer les pièces de cuivre de la main -utilisées pour la banque
 //  作用: 从手牌中移除铜币 - 用于钱庄
 bool Player::trashCopperFromHand()
 {
-    // Itérateur -pointe vers l'élément trouvé (pièces de cuivre)
-    //  迭代器 - 指向查找到的元素(copper铜币)
-    auto it = std::find_if(hand.begin(), hand.end(),
-                           [](const auto &card)
-                           { return card->getName() == "Copper"; });
-
-    if (it != hand.end())
+    if (hand.remove(CardIds::COPPER))
     {
-        trash.push_back(*it);
-        hand.erase(it);
+        trash.push_back(CardIds::COPPER);
+        loseCard(CardIds::COPPER);
         return true;
     }
     return false;
@@ -335,60 +378,43 @@ bool Player::trashCopperFromHand()
 
 // Fonction : Défaussez les cartes en trop en main jusqu'à ce que le nombre de cartes en main atteigne le nombre spécifié -utilisé pour la milice Milice -milice
 //  作用: 弃掉多余的手牌, 直到手牌数量达到指定数量 - 用于民兵 Milice - militia
-void Player::discardDownTo(int count)
+void Player::discardDownTo(int count, const Game &game)
 {
-    while (hand.size() > count)
+    while (static_cast<int>(hand.size()) > count)
     {
-        std::cout << "Main actuelle: ";
-        for (size_t i = 0; i < hand.size(); i++)
-        {
-            std::cout << i + 1 << "." << hand[i]->getName() << " ";
-        }
-
-        std::cout << "\n Veuillez sélectionner le numéro de carte à défausser : ";
-        int choice;
-        std::cin >> choice;
+        int choice = decisions->chooseDiscard(*this, game);
 
-        if (choice > 0 && choice <= hand.size())
+        if (choice >= 0 && choice < static_cast<int>(hand.size()))
         {
-            discard.push_back(hand[choice - 1]);
-            hand.erase(hand.begin() + choice - 1);
+            discard.push_back(hand.removeAt(choice));
         }
     }
 }
 
-// Fonction : défausser les cartes de la main et piocher des cartes -utilisé pour Cave -Cave
+// Fonction : défausser les cartes de la main et piocher des cartes -utilisé pour Cave -Cave
 //  作用: 弃掉手牌并抽牌 - 用于地窖 Cave - cellar
-int Player::discardAndDraw()
+int Player::discardAndDraw(const Game &game)
 {
-    std::cout << "Main actuelle: ";
-    for (size_t i = 0; i < hand.size(); i++)
-    {
-        std::cout << i + 1 << "." << hand[i]->getName() << " ";
-    }
-
-    std::cout << "\nEntrez les numéros des cartes à défausser (séparés par des espaces, entrez 0 pour terminer) : ";
-    int count = 0;
     std::vector<int> choices;
-    int choice;
-
-    while (std::cin >> choice && choice != 0)
+    for (int choice : decisions->chooseCellarDiscards(*this, game))
     {
-        if (choice > 0 && choice <= hand.size())
+        if (choice >= 0 && choice < static_cast<int>(hand.size()))
         {
-            choices.push_back(choice - 1);
-            count++;
+            choices.push_back(choice);
         }
     }
 
     // Trier du plus grand au plus petit pour supprimer de l'arrière vers l'avant
+    // Ignorer les numéros en double
     //  从大到小排序，以便从后往前删除
+    //  忽略重复的编号
     std::sort(choices.rbegin(), choices.rend());
+    choices.erase(std::unique(choices.begin(), choices.end()), choices.end());
+    int count = choices.size();
 
     for (int idx : choices)
     {
-        discard.push_back(hand[idx]);
-        hand.erase(hand.begin() + idx);
+        discard.push_back(hand.removeAt(idx));
     }
 
     // Piochez le même nombre de cartes
@@ -399,14 +425,16 @@ int Player::discardAndDraw()
 
 // Fonction : Récupère toutes les cartes du joueur
 //  作用: 获取玩家所有卡片
-std::vector<std::shared_ptr<Card>> Player::getAllCards() const
+std::vector<CardId> Player::getAllCards() const
 {
-    std::vector<std::shared_ptr<Card>> allCards;
+    std::vector<CardId> allCards;
     // Combine toutes les cartes du deck
     //  合并所有牌组中的卡片
-    allCards.insert(allCards.end(), deck.begin(), deck.end());
+    std::vector<CardId> deckCards = deck.toVector();
+    allCards.insert(allCards.end(), deckCards.begin(), deckCards.end());
     allCards.insert(allCards.end(), hand.begin(), hand.end());
     allCards.insert(allCards.end(), discard.begin(), discard.end());
+    allCards.insert(allCards.end(), inPlay.begin(), inPlay.end());
     return allCards;
 }
 
@@ -414,10 +442,9 @@ std::vector<std::shared_ptr<Card>> Player::getAllCards() const
 //  作用: 弃掉指定编号的卡片 - 用于弃牌
 void Player::discardCard(int index)
 {
-    if (index >= 0 && index < hand.size())
+    if (index >= 0 && index < static_cast<int>(hand.size()))
     {
-        discard.push_back(hand[index]);
-        hand.erase(hand.begin() + index);
+        discard.push_back(hand.removeAt(index));
     }
 }
 
@@ -425,14 +452,9 @@ void Player::discardCard(int index)
 //  作用: 使用地窖后放入弃牌堆 - 用于地窖 Cave - cellar
 void Player::discardCellar()
 {
-    auto it = std::find_if(hand.begin(), hand.end(),
-                           [](const auto &card)
-                           { return card->getName() == "Cellar"; });
-
-    if (it != hand.end())
+    if (hand.remove(CardIds::CELLAR))
     {
-        discard.push_back(*it);
-        hand.erase(it);
+        discard.push_back(CardIds::CELLAR);
     }
 }
 
@@ -440,14 +462,12 @@ void Player::discardCellar()
 //  作用: 展示卡片描述 - 用于展示卡片描述
 void Player::showCardDescription(const std::string &cardName) const
 {
-    for (const auto &card : hand)
+    CardId cardId = Card::findId(cardName);
+    if (cardId != CardIds::INVALID && hand.contains(cardId))
     {
-        if (Utils::equalIgnoreCase(card->getName(), cardName))
-        {
-            std::cout << "\n"
-                      << card->getDescription() << "\n";
-            return;
-        }
+        std::cout << "\n"
+                  << Card::get(cardId).getDescription() << "\n";
+        return;
     }
     std::cout << "La carte est introuvable dans la main.\n";
 }
@@ -458,8 +478,9 @@ void Player::trashCardFromHand(size_t index)
 {
     if (index < hand.size())
     {
-        trash.push_back(hand[index]);
-        hand.erase(hand.begin() + index);
+        CardId card = hand.removeAt(index);
+        trash.push_back(card);
+        loseCard(card);
     }
 }
 
@@ -491,29 +512,39 @@ json Player::toJson() const
     // Sérialiser le deck
     //  序列化牌组
     j["deck"] = json::array();
-    for (const auto &card : deck)
+    for (CardId card : deck.toVector())
     {
-        j["deck"].push_back(card->getName());
+        j["deck"].push_back(Card::get(card).getName());
     }
 
     j["hand"] = json::array();
-    for (const auto &card : hand)
+    for (CardId card : hand)
     {
-        j["hand"].push_back(card->getName());
+        j["hand"].push_back(Card::get(card).getName());
     }
 
     j["discard"] = json::array();
-    for (const auto &card : discard)
+    for (CardId card : discard)
     {
-        j["discard"].push_back(card->getName());
+        j["discard"].push_back(Card::get(card).getName());
+    }
+
+    j["in_play"] = json::array();
+    for (CardId card : inPlay)
+    {
+        j["in_play"].push_back(Card::get(card).getName());
     }
 
     j["trash"] = json::array();
-    for (const auto &card : trash)
+    for (CardId card : trash)
     {
-        j["trash"].push_back(card->getName());
+        j["trash"].push_back(Card::get(card).getName());
     }
 
+    // État du générateur : les mélanges suivants restent identiques après chargement
+    //  生成器状态: 加载后后续洗牌保持一致
+    j["rng"] = rng.getState();
+
     return j;
 }
 
@@ -531,23 +562,95 @@ void Player::fromJson(const json &j)
     deck.clear();
     hand.clear();
     discard.clear();
+    inPlay.clear();
 
     // Charger le deck
     //  加载牌组
     for (const auto &cardJson : j["deck"])
     {
-        deck.push_back(Card::fromJson(cardJson));
+        deck.add(Card::fromJson(cardJson));
     }
 
     for (const auto &cardJson : j["hand"])
     {
-        hand.push_back(Card::fromJson(cardJson));
+        hand.add(Card::fromJson(cardJson));
     }
 
     for (const auto &cardJson : j["discard"])
     {
         discard.push_back(Card::fromJson(cardJson));
     }
+
+    if (j.contains("in_play"))
+    {
+        for (const auto &cardJson : j["in_play"])
+        {
+            inPlay.push_back(Card::fromJson(cardJson));
+        }
+    }
+
+    if (j.contains("rng"))
+    {
+        rng.setState(j["rng"].get<Random::State>());
+    }
+
+    recountCards();
+}
+
+// Fonction : Sérialiser le statut du joueur en binaire -nom, ressources, générateur et zones de cartes
+//  作用: 将玩家状态序列化为二进制 - 名称、资源、生成器和卡片区域
+void Player::toBinary(BinaryWriter &out) const
+{
+    out.str(name);
+    out.i32(actions);
+    out.i32(buys);
+    out.i32(coins);
+    for (std::uint64_t word : rng.getState())
+    {
+        out.u64(word);
+    }
+    out.cards(deck.toVector());
+    out.cards(hand.getCards());
+    out.cards(discard);
+    out.cards(inPlay);
+    out.cards(trash);
+}
+
+// Fonction : Désérialiser le statut du joueur depuis le binaire, exception si une carte est inconnue
+//  作用: 从二进制反序列化玩家状态, 卡片未知时抛出异常
+void Player::fromBinary(BinaryReader &in)
+{
+    name = in.str();
+    actions = in.i32();
+    buys = in.i32();
+    coins = in.i32();
+    Random::State state;
+    for (auto &word : state)
+    {
+        word = in.u64();
+    }
+    rng.setState(state);
+    CardZone deckCards;
+    CardZone handCards;
+    for (auto *zone : {&deckCards, &handCards, &discard, &inPlay, &trash})
+    {
+        in.cards(*zone);
+        for (CardId card : *zone)
+        {
+            if (card >= CardIds::COUNT)
+            {
+                throw std::runtime_error("Carte inconnue dans la sauvegarde binaire: " + std::to_string(card)); // 二进制存档中的未知卡片
+            }
+        }
+    }
+    deck.clear();
+    deck.addAll(deckCards);
+    hand.clear();
+    for (CardId card : handCards)
+    {
+        hand.add(card);
+    }
+    recountCards();
 }
 
 // inutile
@@ -0,0 +1,251 @@
+#include "Replay.h"
+#include "Game.h"
+#include "BinaryIO.h"
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+// Signature et version du format de rejeu
+//  回放格式的签名和版本
+static const char REPLAY_MAGIC[4] = {'D', 'R', 'P', 'L'};
+static const std::uint16_t REPLAY_VERSION = 1;
+
+const std::string Replay::EXTENSION = ".dsr";
+
+// Écrire le rejeu, exception si le fichier ne peut pas être créé
+//  写入回放, 无法创建文件时抛出异常
+void Replay::save(const std::string &filename) const
+{
+    BinaryWriter out;
+    for (char c : REPLAY_MAGIC)
+    {
+        out.u8(static_cast<std::uint8_t>(c));
+    }
+    out.u16(REPLAY_VERSION);
+    out.u64(seed);
+    out.i32(maxTurns);
+    out.u8(static_cast<std::uint8_t>(playerNames.size()));
+    for (const auto &name : playerNames)
+    {
+        out.str(name);
+    }
+    out.u8(static_cast<std::uint8_t>(kingdomCards.size()));
+    for (const auto &card : kingdomCards)
+    {
+        out.str(card);
+    }
+    out.u32(static_cast<std::uint32_t>(decisions.size()));
+    for (std::int32_t decision : decisions)
+    {
+        out.var(decision);
+    }
+    out.u64(finalStateHash);
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("Impossible de créer le fichier de rejeu: " + filename); // 无法创建回放文件
+    }
+    file.write(out.data().data(), static_cast<std::streamsize>(out.data().size()));
+}
+
+// Lire un rejeu, exception si la signature, la version ou le contenu est invalide
+//  读取回放, 签名、版本或内容无效时抛出异常
+Replay Replay::load(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("Impossible d'ouvrir le fichier de rejeu: " + filename); // 无法打开回放文件
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    BinaryReader in(data);
+    for (char c : REPLAY_MAGIC)
+    {
+        if (in.u8() != static_cast<std::uint8_t>(c))
+        {
+            throw std::runtime_error("Ce n'est pas un fichier de rejeu: " + filename); // 不是回放文件
+        }
+    }
+    std::uint16_t version = in.u16();
+    if (version != REPLAY_VERSION)
+    {
+        throw std::runtime_error("Version de rejeu non prise en charge: " + std::to_string(version)); // 不支持的回放版本
+    }
+
+    Replay replay;
+    replay.seed = in.u64();
+    replay.maxTurns = in.i32();
+    replay.playerNames.resize(in.u8());
+    for (auto &name : replay.playerNames)
+    {
+        name = in.str();
+    }
+    replay.kingdomCards.resize(in.u8());
+    for (auto &card : replay.kingdomCards)
+    {
+        card = in.str();
+    }
+    std::uint32_t count = in.u32();
+    replay.decisions.reserve(count);
+    for (std::uint32_t i = 0; i < count; i++)
+    {
+        replay.decisions.push_back(in.var());
+    }
+    replay.finalStateHash = in.u64();
+    if (!in.atEnd())
+    {
+        throw std::runtime_error("Données en trop à la fin du rejeu: " + filename); // 回放末尾有多余数据
+    }
+    return replay;
+}
+
+// Rejouer : même graine, mêmes joueurs, même royaume, décisions lues dans l'ordre
+//  重放: 相同的种子、玩家和王国卡, 按顺序读取决策
+std::uint64_t Replay::run() const
+{
+    Game game(playerNames, kingdomCards, seed);
+    game.setVerbose(false);
+    auto cursor = std::make_shared<ReplayDecisionProvider::Cursor>(decisions);
+    for (size_t seat = 0; seat < playerNames.size(); seat++)
+    {
+        game.setDecisionProvider(seat, std::make_shared<ReplayDecisionProvider>(cursor));
+    }
+    game.runHeadless(maxTurns);
+    if (cursor->next != decisions.size())
+    {
+        throw std::runtime_error("Rejeu désynchronisé: " + std::to_string(decisions.size() - cursor->next) +
+                                 " décisions non utilisées"); // 回放不同步: 有未使用的决策
+    }
+    return game.stateHash();
+}
+
+// Enregistrement
+//  记录
+
+CardId RecordingDecisionProvider::record(CardId card)
+{
+    replay->decisions.push_back(card);
+    return card;
+}
+
+int RecordingDecisionProvider::record(int index)
+{
+    replay->decisions.push_back(index);
+    return index;
+}
+
+CardId RecordingDecisionProvider::chooseAction(const Player &player, const Game &game)
+{
+    return record(inner->chooseAction(player, game));
+}
+
+CardId RecordingDecisionProvider::chooseBuy(const Player &player, const Game &game)
+{
+    return record(inner->chooseBuy(player, game));
+}
+
+CardId RecordingDecisionProvider::chooseGain(const Player &player, const Game &game, int maxCost)
+{
+    return record(inner->chooseGain(player, game, maxCost));
+}
+
+int RecordingDecisionProvider::chooseDiscard(const Player &player, const Game &game)
+{
+    return record(inner->chooseDiscard(player, game));
+}
+
+std::vector<int> RecordingDecisionProvider::chooseCellarDiscards(const Player &player, const Game &game)
+{
+    std::vector<int> choices = inner->chooseCellarDiscards(player, game);
+    record(static_cast<int>(choices.size()));
+    for (int choice : choices)
+    {
+        record(choice);
+    }
+    return choices;
+}
+
+int RecordingDecisionProvider::chooseTrash(const Player &player, const Game &game)
+{
+    return record(inner->chooseTrash(player, game));
+}
+
+int RecordingDecisionProvider::chooseThiefTreasure(const Player &player, const Game &game, const Player &victim,
+                                                   const std::vector<CardId> &treasures)
+{
+    return record(inner->chooseThiefTreasure(player, game, victim, treasures));
+}
+
+// Relecture
+//  读取
+
+// Décision suivante, exception si le rejeu est épuisé
+//  下一个决策, 回放已读完时抛出异常
+std::int32_t ReplayDecisionProvider::Cursor::read()
+{
+    if (next >= decisions.size())
+    {
+        throw std::runtime_error("Rejeu désynchronisé: le moteur demande plus de décisions que le rejeu n'en contient"); // 回放不同步: 引擎请求的决策多于回放中的决策
+    }
+    return decisions[next++];
+}
+
+// Un rejeu corrompu ne doit pas faire lire le moteur hors de la table des cartes
+//  损坏的回放不能让引擎读取到卡片表之外
+CardId ReplayDecisionProvider::Cursor::readCard()
+{
+    std::int32_t value = read();
+    if (value != CardIds::INVALID && (value < 0 || value >= CardIds::COUNT))
+    {
+        throw std::runtime_error("Rejeu désynchronisé: carte inconnue " + std::to_string(value)); // 回放不同步: 未知卡片
+    }
+    return static_cast<CardId>(value);
+}
+
+CardId ReplayDecisionProvider::chooseAction(const Player &, const Game &)
+{
+    return cursor->readCard();
+}
+
+CardId ReplayDecisionProvider::chooseBuy(const Player &, const Game &)
+{
+    return cursor->readCard();
+}
+
+CardId ReplayDecisionProvider::chooseGain(const Player &, const Game &, int)
+{
+    return cursor->readCard();
+}
+
+int ReplayDecisionProvider::chooseDiscard(const Player &, const Game &)
+{
+    return cursor->read();
+}
+
+std::vector<int> ReplayDecisionProvider::chooseCellarDiscards(const Player &, const Game &)
+{
+    std::int32_t count = cursor->read();
+    if (count < 0)
+    {
+        throw std::runtime_error("Rejeu invalide: nombre de cartes de Cave négatif"); // 回放无效: 地窖弃牌数量为负
+    }
+    std::vector<int> choices(count);
+    for (int &choice : choices)
+    {
+        choice = cursor->read();
+    }
+    return choices;
+}
+
+int ReplayDecisionProvider::chooseTrash(const Player &, const Game &)
+{
+    return cursor->read();
+}
+
+int ReplayDecisionProvider::chooseThiefTreasure(const Player &, const Game &, const Player &,
+                                                const std::vector<CardId> &)
+{
+    return cursor->read();
+}
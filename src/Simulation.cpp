@@ -0,0 +1,460 @@
+#include "Simulation.h"
+#include "Game.h"
+#include "BotStrategies.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+// Fusionner les résultats d'un autre lot (mêmes stratégies)
+//  合并另一批的结果(策略相同)
+void SimulationResult::merge(const SimulationResult &other)
+{
+    games += other.games;
+    unfinishedGames += other.unfinishedGames;
+    totalTurns += other.totalTurns;
+    for (size_t i = 0; i < strategies.size() && i < other.strategies.size(); i++)
+    {
+        strategies[i].wins += other.strategies[i].wins;
+        strategies[i].totalVictoryPoints += other.strategies[i].totalVictoryPoints;
+        for (const auto &[points, count] : other.strategies[i].victoryPointsHistogram)
+        {
+            strategies[i].victoryPointsHistogram[points] += count;
+        }
+    }
+    statistics.merge(other.statistics);
+}
+
+// Résultats vides, une entrée par stratégie
+//  空结果, 每个策略一项
+static SimulationResult emptyResult(const SimulationConfig &config)
+{
+    SimulationResult result;
+    for (const auto &name : config.strategies)
+    {
+        StrategyResult strategy;
+        strategy.name = name;
+        result.strategies.push_back(strategy);
+    }
+    result.statistics = GameStatistics(config.strategies);
+    return result;
+}
+
+// Créer la partie gameIndex de la série, bots en place
+// Les places tournent d'une partie à l'autre pour neutraliser l'avantage du premier joueur
+//  创建这批对局中的第 gameIndex 局, 并设置好机器人
+//  座位在每局之间轮换, 以抵消先手优势
+static Game createGame(const SimulationConfig &config, long long gameIndex, std::vector<size_t> &seatStrategy,
+                       std::vector<std::string> &playerNames)
+{
+    size_t numPlayers = config.strategies.size();
+    seatStrategy.resize(numPlayers);
+    playerNames.clear();
+    for (size_t seat = 0; seat < numPlayers; seat++)
+    {
+        seatStrategy[seat] = (seat + gameIndex) % numPlayers;
+        playerNames.push_back(config.strategies[seatStrategy[seat]] + "#" + std::to_string(seat + 1));
+    }
+
+    Game game(playerNames, config.kingdomCards, config.seed + static_cast<std::uint64_t>(gameIndex));
+    game.setVerbose(false);
+    for (size_t seat = 0; seat < numPlayers; seat++)
+    {
+        game.setDecisionProvider(seat, BotStrategies::create(config.strategies[seatStrategy[seat]]));
+    }
+    return game;
+}
+
+// État gardé par un thread d'une partie à l'autre : la partie (relancée par Game::reset), un fournisseur
+// de décisions par stratégie et les noms des joueurs pour chaque rotation des places
+// Chaque stratégie de la configuration a son propre fournisseur, donc chaque siège aussi ; l'état qu'un bot
+// garde d'une partie à l'autre (numéro de décision de MCTS) est remis à zéro par DecisionProvider::reset
+//  线程在对局之间保留的状态: 对局(由 Game::reset 重新开始)、每个策略一个决策提供者,
+//  以及每种座位轮换下的玩家名称
+//  配置中的每个策略有自己的提供者, 因此每个座位也是; 机器人在对局之间保留的状态(MCTS 的决策编号)
+//  由 DecisionProvider::reset 清零
+struct WorkerState
+{
+    std::unique_ptr<Game> game;
+    std::vector<std::shared_ptr<DecisionProvider>> providers;
+    std::vector<std::vector<std::string>> names;
+    std::vector<size_t> seatStrategy;
+
+    explicit WorkerState(const SimulationConfig &config)
+    {
+        size_t numPlayers = config.strategies.size();
+        for (const auto &strategy : config.strategies)
+        {
+            providers.push_back(BotStrategies::create(strategy));
+        }
+        names.resize(numPlayers);
+        for (size_t rotation = 0; rotation < numPlayers; rotation++)
+        {
+            for (size_t seat = 0; seat < numPlayers; seat++)
+            {
+                names[rotation].push_back(config.strategies[(seat + rotation) % numPlayers] + "#" +
+                                          std::to_string(seat + 1));
+            }
+        }
+        seatStrategy.resize(numPlayers);
+    }
+};
+
+// Jouer une partie et l'ajouter aux résultats locaux
+// Même partie que createGame, mais dans l'objet Game du thread : pas de réallocation d'une partie à l'autre
+//  进行一局并加入本地结果
+//  与 createGame 相同的对局, 但使用线程的 Game 对象: 对局之间不重新分配内存
+static void playOneGame(const SimulationConfig &config, long long gameIndex, SimulationResult &result,
+                        WorkerState &state)
+{
+    size_t numPlayers = config.strategies.size();
+    size_t rotation = static_cast<size_t>(gameIndex) % numPlayers;
+    std::vector<size_t> &seatStrategy = state.seatStrategy;
+    for (size_t seat = 0; seat < numPlayers; seat++)
+    {
+        seatStrategy[seat] = (seat + rotation) % numPlayers;
+    }
+    const std::vector<std::string> &playerNames = state.names[rotation];
+
+    std::uint64_t seed = config.seed + static_cast<std::uint64_t>(gameIndex);
+    if (!state.game)
+    {
+        state.game = std::make_unique<Game>(playerNames, config.kingdomCards, seed);
+        state.game->setVerbose(false);
+    }
+    else
+    {
+        state.game->reset(seed, config.kingdomCards, playerNames);
+    }
+    Game &game = *state.game;
+    for (size_t seat = 0; seat < numPlayers; seat++)
+    {
+        game.setDecisionProvider(seat, state.providers[seatStrategy[seat]]);
+    }
+
+    // Comme runHeadless, en relevant les points de chaque siège à la fin de chaque tour complet
+    //  与 runHeadless 相同, 在每个完整回合结束时记录每个座位的点数
+    result.games++;
+    while (!game.isGameOver())
+    {
+        if (config.maxTurns > 0 && game.getTurnCount() > config.maxTurns)
+        {
+            result.unfinishedGames++;
+            return;
+        }
+        game.playTurn();
+        if (game.getCurrentPlayerIndex() == 0)
+        {
+            result.statistics.recordRound(game, seatStrategy);
+        }
+    }
+    result.totalTurns += game.getTurnCount();
+
+    auto scores = game.calculateFinalScores();
+    int bestScore = scores[0].second;
+    for (const auto &[playerName, score] : scores)
+    {
+        bestScore = std::max(bestScore, score);
+    }
+    int winners = static_cast<int>(std::count_if(scores.begin(), scores.end(), [bestScore](const auto &entry)
+                                                 { return entry.second == bestScore; }));
+
+    std::vector<double> seatWins(numPlayers, 0.0);
+    for (size_t seat = 0; seat < numPlayers; seat++)
+    {
+        StrategyResult &strategy = result.strategies[seatStrategy[seat]];
+        // Les scores sont triés : retrouver celui de ce siège par le nom du joueur
+        //  分数已排序: 按玩家名称找到该座位的分数
+        int score = std::find_if(scores.begin(), scores.end(), [&](const auto &entry)
+                                 { return entry.first == playerNames[seat]; })
+                        ->second;
+        strategy.totalVictoryPoints += score;
+        strategy.victoryPointsHistogram[score]++;
+        if (score == bestScore)
+        {
+            seatWins[seat] = 1.0 / winners;
+            strategy.wins += seatWins[seat];
+        }
+    }
+    result.statistics.recordGame(game, seatWins);
+}
+
+// Exception si la configuration est invalide (stratégies, cartes du royaume)
+//  配置无效时抛出异常(策略, 王国卡)
+static void validate(const SimulationConfig &config)
+{
+    if (config.games <= 0)
+    {
+        throw std::runtime_error("Il faut au moins une partie"); // 至少需要一局
+    }
+    if (config.threads < 0)
+    {
+        throw std::runtime_error("Nombre de threads négatif"); // 线程数量为负
+    }
+    if (config.strategies.size() < 2 || config.strategies.size() > 4)
+    {
+        throw std::runtime_error("Il faut entre 2 et 4 stratégies"); // 需要2到4个策略
+    }
+    if (config.kingdomCards.size() != 10)
+    {
+        throw std::runtime_error("Il faut exactement 10 cartes du royaume"); // 需要正好10张王国卡
+    }
+    for (const auto &cardName : config.kingdomCards)
+    {
+        Card::idOf(cardName); // Exception si la carte est inconnue
+                              //  卡片未知时抛出异常
+    }
+    for (const auto &name : config.strategies)
+    {
+        BotStrategies::create(name); // Vérifier le nom avant de lancer les threads
+                                     //  在启动线程前检查名称
+    }
+}
+
+// Nombre de threads de travail : config.threads, ou tous les cœurs, sans dépasser le nombre de parties
+//  工作线程数量: config.threads 或所有核心, 不超过对局数量
+static int workerCount(const SimulationConfig &config)
+{
+    int threads = config.threads > 0 ? config.threads : static_cast<int>(std::thread::hardware_concurrency());
+    return static_cast<int>(std::max<long long>(1, std::min<long long>(threads, config.games)));
+}
+
+// Lancer la série et renvoyer les résultats agrégés, exception si la configuration est invalide
+//  运行这批对局并返回汇总结果, 配置无效时抛出异常
+SimulationResult Simulation::run(const SimulationConfig &config)
+{
+    validate(config);
+    int threads = workerCount(config);
+
+    SimulationResult total = emptyResult(config);
+    std::atomic<long long> nextGame(0);
+    std::mutex mergeMutex;
+    std::exception_ptr failure;
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Chaque thread prend la prochaine partie libre et accumule localement, puis fusionne une seule fois
+    //  每个线程领取下一局并在本地累计, 最后只合并一次
+    auto worker = [&]()
+    {
+        SimulationResult local = emptyResult(config);
+        try
+        {
+            WorkerState state(config);
+            for (long long gameIndex = nextGame++; gameIndex < config.games; gameIndex = nextGame++)
+            {
+                playOneGame(config, gameIndex, local, state);
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mergeMutex);
+            failure = std::current_exception();
+            nextGame = config.games;
+        }
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        total.merge(local);
+    };
+
+    std::vector<std::thread> pool;
+    for (int i = 0; i < threads; i++)
+    {
+        pool.emplace_back(worker);
+    }
+    for (auto &thread : pool)
+    {
+        thread.join();
+    }
+
+    if (failure)
+    {
+        std::rethrow_exception(failure);
+    }
+
+    total.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return total;
+}
+
+// Test de charge : d'abord chaque partie seule sur ce thread (empreinte de référence), puis toutes les
+// parties en même temps, réparties entre les threads qui avancent chacune d'un tour à tour de rôle
+// À chaque tour, une copie (fork) doit avoir la même empreinte que l'original
+//  压力测试: 先在本线程上单独进行每一局(参考哈希), 然后所有对局同时存在,
+//  分配给各线程, 每个线程轮流让每局前进一回合
+//  每回合, 副本(fork)的哈希必须与原局相同
+StressResult Simulation::stress(const SimulationConfig &config)
+{
+    validate(config);
+    int threads = workerCount(config);
+
+    std::vector<std::uint64_t> expected(config.games);
+    std::vector<std::uint64_t> actual(config.games);
+    std::vector<size_t> seatStrategy;
+    std::vector<std::string> playerNames;
+    for (long long gameIndex = 0; gameIndex < config.games; gameIndex++)
+    {
+        Game game = createGame(config, gameIndex, seatStrategy, playerNames);
+        game.runHeadless(config.maxTurns);
+        expected[gameIndex] = game.stateHash();
+    }
+
+    StressResult result;
+    result.games = config.games;
+    std::atomic<long long> forkMismatches(0);
+    std::mutex failureMutex;
+    std::exception_ptr failure;
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Le thread t joue les parties t, t + threads, t + 2 * threads... toutes ouvertes dès le départ
+    //  线程 t 负责第 t, t + threads, t + 2 * threads... 局, 一开始就全部创建
+    auto worker = [&](int thread)
+    {
+        try
+        {
+            std::vector<long long> indices;
+            std::vector<Game> games;
+            std::vector<size_t> seats;
+            std::vector<std::string> names;
+            for (long long gameIndex = thread; gameIndex < config.games; gameIndex += threads)
+            {
+                indices.push_back(gameIndex);
+                games.push_back(createGame(config, gameIndex, seats, names));
+            }
+
+            std::vector<bool> running(games.size(), true);
+            for (size_t remaining = games.size(); remaining > 0;)
+            {
+                for (size_t i = 0; i < games.size(); i++)
+                {
+                    Game &game = games[i];
+                    if (!running[i])
+                    {
+                        continue;
+                    }
+                    if (game.isGameOver() || (config.maxTurns > 0 && game.getTurnCount() > config.maxTurns))
+                    {
+                        actual[indices[i]] = game.stateHash();
+                        running[i] = false;
+                        remaining--;
+                        continue;
+                    }
+                    game.playTurn();
+                    if (game.fork().stateHash() != game.stateHash())
+                    {
+                        forkMismatches++;
+                    }
+                }
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(failureMutex);
+            failure = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int i = 0; i < threads; i++)
+    {
+        pool.emplace_back(worker, i);
+    }
+    for (auto &thread : pool)
+    {
+        thread.join();
+    }
+    if (failure)
+    {
+        std::rethrow_exception(failure);
+    }
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.forkMismatches = forkMismatches;
+    for (long long gameIndex = 0; gameIndex < config.games; gameIndex++)
+    {
+        if (actual[gameIndex] != expected[gameIndex])
+        {
+            result.mismatches++;
+        }
+    }
+    return result;
+}
+
+// Point de victoire au centile donné d'un histogramme
+//  直方图中指定百分位的胜利点数
+static int percentile(const std::map<int, long long> &histogram, long long total, double fraction)
+{
+    long long target = static_cast<long long>(fraction * (total - 1));
+    long long seen = 0;
+    for (const auto &[points, count] : histogram)
+    {
+        seen += count;
+        if (seen > target)
+        {
+            return points;
+        }
+    }
+    return histogram.empty() ? 0 : histogram.rbegin()->first;
+}
+
+// Afficher taux de victoire, nombre moyen de tours et distribution des points
+//  显示胜率、平均回合数和点数分布
+void Simulation::printReport(const SimulationResult &result)
+{
+    long long finished = result.games - result.unfinishedGames;
+
+    std::cout << "\n=== Résultats de la simulation ===\n";
+    std::cout << "Parties jouées: " << result.games
+              << " (inachevées: " << result.unfinishedGames << ")\n";
+    std::cout << std::fixed << std::setprecision(2);
+    if (finished > 0)
+    {
+        std::cout << "Nombre moyen de tours: " << static_cast<double>(result.totalTurns) / finished << "\n";
+    }
+    if (result.seconds > 0)
+    {
+        std::cout << "Durée: " << result.seconds << " s ("
+                  << std::setprecision(0) << result.games / result.seconds << " parties/s)\n"
+                  << std::setprecision(2);
+    }
+
+    std::cout << std::string(72, '-') << "\n";
+    std::cout << std::left << std::setw(16) << "Stratégie" << std::right
+              << std::setw(10) << "Victoire%"
+              << std::setw(10) << "PV moyen"
+              << std::setw(8) << "min"
+              << std::setw(8) << "p10"
+              << std::setw(8) << "p50"
+              << std::setw(8) << "p90"
+              << std::setw(8) << "max" << "\n";
+    std::cout << std::string(72, '-') << "\n";
+
+    for (const auto &strategy : result.strategies)
+    {
+        long long samples = 0;
+        for (const auto &[points, count] : strategy.victoryPointsHistogram)
+        {
+            samples += count;
+        }
+
+        std::cout << std::left << std::setw(16) << strategy.name << std::right
+                  << std::setw(10) << (finished > 0 ? 100.0 * strategy.wins / finished : 0.0)
+                  << std::setw(10) << (samples > 0 ? static_cast<double>(strategy.totalVictoryPoints) / samples : 0.0);
+        if (samples > 0)
+        {
+            std::cout << std::setw(8) << strategy.victoryPointsHistogram.begin()->first
+                      << std::setw(8) << percentile(strategy.victoryPointsHistogram, samples, 0.1)
+                      << std::setw(8) << percentile(strategy.victoryPointsHistogram, samples, 0.5)
+                      << std::setw(8) << percentile(strategy.victoryPointsHistogram, samples, 0.9)
+                      << std::setw(8) << strategy.victoryPointsHistogram.rbegin()->first;
+        }
+        std::cout << "\n";
+    }
+    std::cout << std::string(72, '-') << "\n";
+    std::cout.unsetf(std::ios::fixed);
+}
@@ -0,0 +1,218 @@
+#include "Statistics.h"
+#include "Game.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+GameStatistics::GameStatistics(std::vector<std::string> groupNames)
+    : groupNames(std::move(groupNames)), victoryPoints(this->groupNames.size())
+{
+    // Les clés JSON et les lignes CSV sont nommées par groupe : des noms en double les confondraient
+    //  JSON 的键和 CSV 的行按组命名: 重复的名称会使它们混淆
+    const std::vector<std::string> names = this->groupNames;
+    for (std::size_t group = 0; group < names.size(); group++)
+    {
+        if (std::count(names.begin(), names.end(), names[group]) > 1)
+        {
+            this->groupNames[group] = names[group] + "#" + std::to_string(group + 1);
+        }
+    }
+}
+
+// Ajouter value à counts[index], en agrandissant le tableau si besoin
+//  将 value 加到 counts[index], 需要时扩大数组
+static void addAt(std::vector<long long> &counts, std::size_t index, long long value)
+{
+    if (counts.size() <= index)
+    {
+        counts.resize(index + 1, 0);
+    }
+    counts[index] += value;
+}
+
+// Additionner deux tableaux de compteurs de tailles différentes
+//  相加两个长度不同的计数器数组
+static void addAll(std::vector<long long> &counts, const std::vector<long long> &other)
+{
+    if (counts.size() < other.size())
+    {
+        counts.resize(other.size(), 0);
+    }
+    for (std::size_t i = 0; i < other.size(); i++)
+    {
+        counts[i] += other[i];
+    }
+}
+
+void GameStatistics::recordRound(const Game &game, const std::vector<std::size_t> &seatGroup)
+{
+    // Le tour qui vient de se terminer (turnCount est déjà passé au suivant)
+    //  刚结束的回合(turnCount 已经进入下一回合)
+    std::size_t turn = static_cast<std::size_t>(game.getTurnCount() - 1);
+    const auto &players = game.getPlayers();
+    for (std::size_t seat = 0; seat < players.size() && seat < seatGroup.size(); seat++)
+    {
+        VictoryPointsByTurn &group = victoryPoints.at(seatGroup[seat]);
+        addAt(group.sum, turn, players[seat].getVictoryPoints());
+        addAt(group.samples, turn, 1);
+    }
+}
+
+// Un seul parcours du journal : chaque carte compte au plus une fois par siège pour le taux de victoire
+//  只遍历一次日志: 计算胜率时每张卡片每个座位最多计一次
+void GameStatistics::recordGame(const Game &game, const std::vector<double> &seatWins)
+{
+    games++;
+    std::vector<std::array<bool, CardIds::COUNT>> acquired(seatWins.size());
+    for (auto &seen : acquired)
+    {
+        seen.fill(false);
+    }
+
+    for (const GameEvent &event : game.getLogger().getEvents())
+    {
+        if (event.kind != GameEventKind::CARD_BOUGHT && event.kind != GameEventKind::CARD_GAINED)
+        {
+            continue;
+        }
+        if (event.player >= seatWins.size() || event.card >= CardIds::COUNT)
+        {
+            continue;
+        }
+        if (event.kind == GameEventKind::CARD_BOUGHT)
+        {
+            addAt(cards[event.card].buyTurns, static_cast<std::size_t>(std::max<int>(event.turn, 0)), 1);
+        }
+        acquired[event.player][event.card] = true;
+    }
+
+    for (std::size_t seat = 0; seat < seatWins.size(); seat++)
+    {
+        for (CardId card = 0; card < CardIds::COUNT; card++)
+        {
+            if (acquired[seat][card])
+            {
+                cards[card].acquiredBy++;
+                cards[card].wins += seatWins[seat];
+            }
+        }
+    }
+}
+
+void GameStatistics::merge(const GameStatistics &other)
+{
+    games += other.games;
+    for (CardId card = 0; card < CardIds::COUNT; card++)
+    {
+        cards[card].acquiredBy += other.cards[card].acquiredBy;
+        cards[card].wins += other.cards[card].wins;
+        addAll(cards[card].buyTurns, other.cards[card].buyTurns);
+    }
+    for (std::size_t group = 0; group < victoryPoints.size() && group < other.victoryPoints.size(); group++)
+    {
+        addAll(victoryPoints[group].sum, other.victoryPoints[group].sum);
+        addAll(victoryPoints[group].samples, other.victoryPoints[group].samples);
+    }
+}
+
+double GameStatistics::averageVictoryPoints(std::size_t group, int turn) const
+{
+    const VictoryPointsByTurn &points = victoryPoints.at(group);
+    if (turn < 0 || static_cast<std::size_t>(turn) >= points.samples.size() || points.samples[turn] == 0)
+    {
+        return 0;
+    }
+    return static_cast<double>(points.sum[turn]) / points.samples[turn];
+}
+
+void GameStatistics::writeCsv(std::ostream &out) const
+{
+    out << "mesure,nom,tour,echantillons,valeur\n";
+    for (CardId card = 0; card < CardIds::COUNT; card++)
+    {
+        const CardCounters &counters = cards[card];
+        if (counters.acquiredBy > 0)
+        {
+            out << "victoire_par_carte," << CARD_DEFINITIONS[card].name << ",," << counters.acquiredBy << ","
+                << counters.wins / counters.acquiredBy << "\n";
+        }
+    }
+    for (std::size_t group = 0; group < victoryPoints.size(); group++)
+    {
+        const VictoryPointsByTurn &points = victoryPoints[group];
+        for (std::size_t turn = 0; turn < points.samples.size(); turn++)
+        {
+            if (points.samples[turn] > 0)
+            {
+                out << "pv_par_tour," << groupNames[group] << "," << turn << "," << points.samples[turn] << ","
+                    << static_cast<double>(points.sum[turn]) / points.samples[turn] << "\n";
+            }
+        }
+    }
+    for (CardId card = 0; card < CardIds::COUNT; card++)
+    {
+        const auto &buyTurns = cards[card].buyTurns;
+        for (std::size_t turn = 0; turn < buyTurns.size(); turn++)
+        {
+            if (buyTurns[turn] > 0)
+            {
+                out << "achats_par_tour," << CARD_DEFINITIONS[card].name << "," << turn << "," << games << ","
+                    << buyTurns[turn] << "\n";
+            }
+        }
+    }
+}
+
+json GameStatistics::toJson() const
+{
+    json j;
+    j["games"] = games;
+
+    json cardsJson = json::object();
+    for (CardId card = 0; card < CardIds::COUNT; card++)
+    {
+        const CardCounters &counters = cards[card];
+        if (counters.acquiredBy == 0 && counters.buyTurns.empty())
+        {
+            continue;
+        }
+        json cardJson;
+        cardJson["acquired_by"] = counters.acquiredBy;
+        cardJson["win_rate"] = counters.acquiredBy > 0 ? counters.wins / counters.acquiredBy : 0.0;
+        cardJson["buy_turns"] = counters.buyTurns;
+        cardsJson[CARD_DEFINITIONS[card].name] = cardJson;
+    }
+    j["cards"] = cardsJson;
+
+    json pointsJson = json::object();
+    for (std::size_t group = 0; group < victoryPoints.size(); group++)
+    {
+        json averages = json::array();
+        for (std::size_t turn = 0; turn < victoryPoints[group].samples.size(); turn++)
+        {
+            averages.push_back(averageVictoryPoints(group, static_cast<int>(turn)));
+        }
+        pointsJson[groupNames[group]] = averages;
+    }
+    j["victory_points_by_turn"] = pointsJson;
+    return j;
+}
+
+void GameStatistics::save(const std::string &filename) const
+{
+    std::ofstream out(filename);
+    if (!out)
+    {
+        throw std::runtime_error("Impossible de créer le fichier de statistiques: " + filename); // 无法创建统计文件
+    }
+    bool isJson = filename.size() >= 5 && filename.compare(filename.size() - 5, 5, ".json") == 0;
+    if (isJson)
+    {
+        out << std::setw(4) << toJson() << "\n";
+    }
+    else
+    {
+        writeCsv(out);
+    }
+}
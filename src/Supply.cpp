@@ -0,0 +1,69 @@
+#include "Supply.h"
+#include "BinaryIO.h"
+
+// Retirer toutes les piles
+//  移除所有供应堆
+void Supply::clear()
+{
+    counts.fill(0);
+    piles = 0;
+    emptyPiles = 0;
+}
+
+// Ajouter (ou remplacer) une pile de count cartes
+//  添加(或替换)一个有 count 张牌的供应堆
+void Supply::setPile(CardId card, int count)
+{
+    if (contains(card) && counts[card] == 0)
+    {
+        emptyPiles--;
+    }
+    piles |= 1u << card;
+    counts[card] = count;
+    if (count == 0)
+    {
+        emptyPiles++;
+    }
+}
+
+// Retirer une carte de la pile, renvoie false si la pile est absente ou vide
+//  从供应堆取出一张牌, 供应堆不存在或为空时返回 false
+bool Supply::take(CardId card)
+{
+    if (!contains(card) || counts[card] == 0)
+    {
+        return false;
+    }
+    if (--counts[card] == 0)
+    {
+        emptyPiles++;
+    }
+    return true;
+}
+
+// Sauvegarde binaire : masque des piles puis nombre de cartes de chaque pile présente
+//  二进制存档: 供应堆掩码, 然后是每个存在的供应堆的卡片数量
+void Supply::toBinary(BinaryWriter &out) const
+{
+    out.u32(piles);
+    for (CardId card = 0; card < CardIds::COUNT; card++)
+    {
+        if (contains(card))
+        {
+            out.u16(static_cast<std::uint16_t>(counts[card]));
+        }
+    }
+}
+
+void Supply::fromBinary(BinaryReader &in)
+{
+    clear();
+    std::uint32_t savedPiles = in.u32();
+    for (CardId card = 0; card < CardIds::COUNT; card++)
+    {
+        if (savedPiles >> card & 1u)
+        {
+            setPile(card, in.u16());
+        }
+    }
+}
@@ -0,0 +1,203 @@
+#include "TerminalDecisionProvider.h"
+#include "Player.h"
+#include "Game.h"
+#include "Utils.h"
+#include <iostream>
+#include <limits>
+
+// Lire un entier au terminal, renvoie false si la saisie est invalide
+//  从终端读取一个整数, 输入无效时返回 false
+static bool readInt(int &value)
+{
+    if (std::cin >> value)
+    {
+        return true;
+    }
+    if (!std::cin.eof())
+    {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return false;
+}
+
+// Afficher la main numérotée (à partir de 1)
+//  显示带编号的手牌(从1开始)
+static void printNumberedHand(const Player &player)
+{
+    const auto &hand = player.getHand();
+    std::cout << "Main actuelle: ";
+    for (size_t i = 0; i < hand.size(); i++)
+    {
+        std::cout << i + 1 << "." << Card::get(hand[i]).getName() << " ";
+    }
+}
+
+// Phase d'action : 'show' pour voir les cartes, 'info [nom]' pour la description, 'skip' pour passer
+//  行动阶段: 'show' 查看手牌, 'info [卡名]' 查看描述, 'skip' 跳过
+CardId TerminalDecisionProvider::chooseAction(const Player &player, const Game &game)
+{
+    while (true)
+    {
+        std::cout << "[Tour " << game.getTurnCount() << "] "
+                  << player.getName()
+                  << " choisissez une carte d'action à utiliser ('show' pour voir les cartes, 'info [nom de carte]' pour voir la description, 'skip' pour passer): ";
+
+        std::string input;
+        if (!std::getline(std::cin, input) || Utils::equalIgnoreCase(input, "skip"))
+        {
+            return CardIds::INVALID;
+        }
+        if (Utils::equalIgnoreCase(input, "show"))
+        {
+            player.showHand();
+            std::cout << "\n";
+            continue;
+        }
+        if (input.substr(0, 4) == "info")
+        {
+            player.showCardDescription(input.size() > 5 ? input.substr(5) : "");
+            continue;
+        }
+        if (input.empty())
+        {
+            continue;
+        }
+
+        CardId id = Card::findId(input);
+        if (id == CardIds::INVALID)
+        {
+            std::cout << "La carte est introuvable\n";
+            continue;
+        }
+        return id;
+    }
+}
+
+// Phase d'achat : afficher la réserve puis lire le nom de la carte, 'done' pour terminer
+//  购买阶段: 显示供应堆后读取卡片名称, 'done' 结束
+CardId TerminalDecisionProvider::chooseBuy(const Player &player, const Game &game)
+{
+    while (true)
+    {
+        std::cout << "\n[" << player.getName() << "] Nombre d'achats restants: "
+                  << player.getBuys() << "\n";
+
+        // Afficher les cartes disponibles
+        //  显示可购买的卡片
+        game.displaySupplyPiles();
+
+        // Afficher les pièces d'or disponibles
+        //  显示可用金币
+        std::cout << "\n[" << player.getName() << "] Pièces disponibles: "
+                  << player.getCoins() << "\n";
+
+        std::cout << "[" << player.getName()
+                  << "] Entrez le nom de la carte à acheter, ou 'done' pour terminer la phase d'achat: ";
+
+        std::string input;
+        if (!std::getline(std::cin, input) || Utils::equalIgnoreCase(input, "done"))
+        {
+            return CardIds::INVALID;
+        }
+
+        CardId id = Card::findId(input);
+        if (id == CardIds::INVALID)
+        {
+            std::cout << "Carte introuvable\n";
+            continue;
+        }
+        return id;
+    }
+}
+
+// Obtenir une carte : afficher les cartes éligibles puis lire le nom
+//  获得卡片: 显示符合条件的卡片后读取名称
+CardId TerminalDecisionProvider::chooseGain(const Player &, const Game &game, int maxCost)
+{
+    game.displayGainableCards(maxCost);
+
+    std::cout << "\nVeuillez entrer le nom de la carte que vous souhaitez obtenir: ";
+    std::string input;
+    std::getline(std::cin, input);
+    return Card::findId(input);
+}
+
+// Milice : choisir une carte à défausser
+//  民兵: 选择一张要弃掉的牌
+int TerminalDecisionProvider::chooseDiscard(const Player &player, const Game &)
+{
+    printNumberedHand(player);
+
+    std::cout << "\n Veuillez sélectionner le numéro de carte à défausser : ";
+    int choice;
+    if (!readInt(choice))
+    {
+        // Entrée fermée : défausser la première carte pour ne pas boucler indéfiniment
+        //  输入已关闭: 弃掉第一张牌, 避免无限循环
+        return std::cin.eof() ? 0 : -1;
+    }
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    return choice - 1;
+}
+
+// Cave : lire les numéros des cartes à défausser jusqu'à 0
+//  地窖: 读取要弃掉的牌的编号, 直到输入0
+std::vector<int> TerminalDecisionProvider::chooseCellarDiscards(const Player &player, const Game &)
+{
+    printNumberedHand(player);
+
+    std::cout << "\nEntrez les numéros des cartes à défausser (séparés par des espaces, entrez 0 pour terminer) : ";
+    std::vector<int> choices;
+    int choice;
+    while (readInt(choice) && choice != 0)
+    {
+        choices.push_back(choice - 1);
+    }
+    if (!std::cin.eof())
+    {
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return choices;
+}
+
+// Chapelle : choisir une carte à écarter, 0 pour terminer
+//  教堂: 选择要废除的牌, 输入0结束
+int TerminalDecisionProvider::chooseTrash(const Player &player, const Game &)
+{
+    std::cout << "Main actuelle:\n";
+    const auto &hand = player.getHand();
+    for (size_t i = 0; i < hand.size(); i++)
+    {
+        std::cout << i + 1 << ". " << Card::get(hand[i]).getName() << "\n";
+    }
+
+    std::cout << "Sélectionnez la carte à rubuter (entrez 0 pour terminer): ";
+    int choice;
+    if (!readInt(choice))
+    {
+        return -1;
+    }
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    return choice - 1;
+}
+
+// Voleur : choisir le trésor à obtenir
+//  窃贼: 选择要获得的财宝牌
+int TerminalDecisionProvider::chooseThiefTreasure(const Player &, const Game &, const Player &,
+                                                  const std::vector<CardId> &treasures)
+{
+    std::cout << "Sélectionnez la carte au trésor que vous souhaitez obtenir (entrez le numéro):\n";
+    for (size_t i = 0; i < treasures.size(); i++)
+    {
+        std::cout << i + 1 << ". " << Card::get(treasures[i]).getName() << "\n";
+    }
+
+    int choice;
+    if (!readInt(choice))
+    {
+        return -1;
+    }
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    return choice - 1;
+}
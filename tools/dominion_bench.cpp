@@ -0,0 +1,329 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Game.h"
+#include "Player.h"
+#include "Card.h"
+#include "BotStrategies.h"
+
+// Microbenchmarks des chemins chauds du moteur : ns/op et allocations/op
+//  引擎热点路径的微基准测试: 每次操作的纳秒数和内存分配次数
+//
+// make bench                      (compile en -O2 dans build/bench puis lance tout)
+// ./bin/dominion-bench drawCard   (seulement les benchmarks dont le nom contient le filtre)
+
+// Compteur d'allocations : toutes les allocations du programme passent par cet operator new
+// Le benchmark est mono-thread, un simple compteur suffit
+//  内存分配计数器: 程序中的所有分配都经过这个 operator new
+//  基准测试是单线程的, 简单计数器即可
+static long long allocationCount = 0;
+
+void *operator new(std::size_t size)
+{
+    allocationCount++;
+    if (void *memory = std::malloc(size ? size : 1))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+
+// Empêcher le compilateur de supprimer un résultat inutilisé
+//  防止编译器删除未使用的结果
+template <typename T>
+static void keep(const T &value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+static std::string filter;
+
+// Sortie des résultats : tampon de la console d'origine, toujours visible même quand std::cout est coupé
+//  结果输出: 使用原始控制台缓冲区, 即使 std::cout 被关闭也可见
+static std::ostream &report()
+{
+    static std::ostream stream(std::cout.rdbuf());
+    return stream;
+}
+
+// Lancer op en doublant le nombre d'itérations jusqu'à environ 200 ms, puis afficher ns/op et allocations/op
+//  以倍增的迭代次数运行 op 直到约200毫秒, 然后显示每次操作的纳秒数和分配次数
+template <typename Op>
+static void bench(const std::string &name, Op op)
+{
+    if (!filter.empty() && name.find(filter) == std::string::npos)
+    {
+        return;
+    }
+
+    op(); // Échauffement : caches et capacités des vecteurs
+          //  预热: 缓存和向量容量
+
+    using Clock = std::chrono::steady_clock;
+    for (long long iterations = 1;; iterations *= 2)
+    {
+        long long allocationsBefore = allocationCount;
+        auto start = Clock::now();
+        for (long long i = 0; i < iterations; i++)
+        {
+            op();
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (seconds >= 0.2 || iterations >= (1LL << 40))
+        {
+            report() << std::left << std::setw(36) << name << std::right
+                      << std::setw(14) << std::fixed << std::setprecision(1) << seconds * 1e9 / iterations << " ns/op"
+                      << std::setw(12) << std::setprecision(2)
+                      << static_cast<double>(allocationCount - allocationsBefore) / iterations << " allocs/op"
+                      << std::setw(12) << iterations << " itér.\n";
+            return;
+        }
+    }
+}
+
+// Partie entre deux bots, avancée de quelques tours (état de milieu de partie)
+//  两个机器人之间的对局, 进行了若干回合(中盘状态)
+static Game midGame(int turns)
+{
+    Game game({"Alice", "Bob"}, Game::getFixedKingdomSet("advanced"), 42);
+    game.setVerbose(false);
+    game.setDecisionProvider(0, BotStrategies::create("witch"));
+    game.setDecisionProvider(1, BotStrategies::create("engine"));
+    game.runHeadless(turns);
+    return game;
+}
+
+// Joueur avec un deck de départ de 7 Cuivres et 3 Domaines, rien en main
+//  拥有7张铜币和3张庄园起始牌组的玩家, 手牌为空
+static Player starterPlayer()
+{
+    Player player("Bench");
+    player.setVerbose(false);
+    player.seedRandom(7);
+    for (int i = 0; i < 7; i++)
+        player.addToDeck(CardIds::COPPER);
+    for (int i = 0; i < 3; i++)
+        player.addToDeck(CardIds::ESTATE);
+    return player;
+}
+
+// Remettre en main les cartes d'une zone, puis la vider
+//  把一个区域的卡片放回手牌, 然后清空该区域
+static void returnToHand(Player &player, CardZone &zone)
+{
+    for (CardId card : zone)
+        player.addToHand(card);
+    zone.clear();
+}
+
+// Couper la sortie console de saveGame/loadGame pendant la mesure
+//  测量期间关闭 saveGame/loadGame 的控制台输出
+class MuteStdout
+{
+private:
+    std::ostringstream sink;
+    std::streambuf *previous;
+
+public:
+    MuteStdout() : previous(std::cout.rdbuf(sink.rdbuf())) {}
+    ~MuteStdout() { std::cout.rdbuf(previous); }
+    void clear() { sink.str(std::string()); }
+};
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1)
+    {
+        filter = argv[1];
+    }
+
+    report() << "=== Microbenchmarks du moteur ===\n";
+
+    // Piocher une carte ; quand la pioche est vide, la main part en défausse
+    // et la pioche suivante la remet dans la pioche
+    //  抽一张牌; 牌堆空时, 手牌进入弃牌堆, 下一次抽牌时再并入牌堆
+    {
+        Player player = starterPlayer();
+        bench("Player::drawCard", [&]()
+              {
+                  player.drawCard(1);
+                  if (player.getDeck().empty())
+                      player.discardHand();
+              });
+    }
+
+    // Verser une défausse de 30 cartes dans la pioche
+    //  把30张牌的弃牌堆并入牌堆
+    {
+        Player player = starterPlayer();
+        std::vector<CardId> discardPile;
+        for (int i = 0; i < 30; i++)
+            discardPile.push_back(i % 3 ? CardIds::COPPER : (i % 2 ? CardIds::SILVER : CardIds::SMITHY));
+        bench("Player::shuffleDeck (30 cartes)", [&]()
+              {
+                  player.getDiscard().assign(discardPile.begin(), discardPile.end());
+                  player.shuffleDeck();
+                  player.getDeck().clear();
+              });
+    }
+
+    // Défausser une main de 5 cartes et 2 cartes en jeu, puis les remettre en main
+    //  弃掉5张手牌和2张场上的牌, 然后放回手牌
+    {
+        Player player = starterPlayer();
+        player.drawCard(7);
+        bench("Player::discardHand (5+2 cartes)", [&]()
+              {
+                  auto &inPlay = player.getInPlay();
+                  auto &hand = player.getHand();
+                  inPlay.assign(hand.end() - 2, hand.end());
+                  hand.removeAt(hand.size() - 1);
+                  hand.removeAt(hand.size() - 1);
+                  player.discardHand();
+                  returnToHand(player, player.getDiscard());
+              });
+    }
+
+    // Jouer une main de 7 trésors, puis les reprendre en main
+    //  使用7张财宝手牌, 然后放回手牌
+    {
+        Player player = starterPlayer();
+        for (CardId card : {CardIds::COPPER, CardIds::COPPER, CardIds::COPPER, CardIds::SILVER,
+                            CardIds::SILVER, CardIds::GOLD, CardIds::GOLD})
+            player.addToHand(card);
+        bench("Player::playAllTreasures (7 trésors)", [&]()
+              {
+                  player.resetCoins();
+                  player.playAllTreasures();
+                  keep(player.getCoins());
+                  returnToHand(player, player.getInPlay());
+              });
+    }
+
+    // Main de 20 cartes riche en Or, avec des cartes action et victoire à garder en main
+    //  20张以金币为主的手牌, 其中的行动卡和胜利卡留在手中
+    {
+        Player player = starterPlayer();
+        for (int i = 0; i < 20; i++)
+            player.addToHand(i % 5 == 4 ? CardIds::SMITHY : (i % 5 == 3 ? CardIds::PROVINCE : CardIds::GOLD));
+        bench("Player::playAllTreasures (20 cartes)", [&]()
+              {
+                  player.resetCoins();
+                  player.playAllTreasures();
+                  keep(player.getCoins());
+                  returnToHand(player, player.getInPlay());
+              });
+    }
+
+    // Jouer une carte action, puis remettre la carte piochée en défausse
+    // Partie fork : journal désactivé, le joueur du benchmark n'a pas besoin d'y être
+    //  使用一张行动卡, 然后把抽到的牌放回弃牌堆
+    //  fork 的对局: 日志已关闭, 基准测试的玩家不需要在其中
+    {
+        Game game = midGame(0).fork();
+        for (CardId action : {CardIds::MARKET, CardIds::MILITIA})
+        {
+            Player player = starterPlayer();
+            player.drawCard(5);
+            bench(std::string("Player::playAction (") + Card::get(action).getName() + ")", [&]()
+                  {
+                      player.addToHand(action);
+                      player.setActions(1);
+                      player.playAction(action, game);
+                      player.getInPlay().clear();
+                      auto &hand = player.getHand();
+                      while (hand.size() > 5)
+                      {
+                          player.addToDiscard(hand.removeAt(hand.size() - 1));
+                      }
+                  });
+        }
+    }
+
+    // Fabrique par nom
+    //  按名称的工厂
+    bench("Card::createCard", []()
+          { keep(Card::createCard("Village")); });
+
+    // Décompte final en milieu de partie
+    //  中盘时的最终计分
+    {
+        Game game = midGame(12);
+        bench("Game::calculateFinalScores", [&]()
+              { keep(game.calculateFinalScores()); });
+    }
+
+    // Sauvegarde et chargement (JSON et binaire) d'une partie de milieu de partie
+    //  中盘对局的保存和加载(JSON 和二进制)
+    {
+        Game game = midGame(12);
+        auto directory = std::filesystem::temp_directory_path();
+        std::string jsonFile = (directory / "dominion-bench.json").string();
+        std::string binaryFile = (directory / ("dominion-bench" + Game::BINARY_SAVE_EXTENSION)).string();
+
+        MuteStdout mute;
+        bench("Game::saveGame (JSON)", [&]()
+              { game.saveGame(jsonFile); mute.clear(); });
+        bench("Game::loadGame (JSON)", [&]()
+              { game.loadGame(jsonFile); mute.clear(); });
+        bench("Game::saveGame (binaire)", [&]()
+              { game.saveGame(binaryFile); mute.clear(); });
+        bench("Game::loadGame (binaire)", [&]()
+              { game.loadGame(binaryFile); mute.clear(); });
+
+        std::remove(jsonFile.c_str());
+        std::remove(binaryFile.c_str());
+    }
+
+    // Partie complète entre bots : construction, mise en place et jeu jusqu'à la fin
+    //  完整的机器人对局: 构造、初始化并进行到结束
+    {
+        std::uint64_t seed = 1;
+        bench("Partie complète smithy vs bigmoney", [&]()
+              {
+                  Game game({"A", "B"}, Game::getFixedKingdomSet("beginner"), seed++);
+                  game.setVerbose(false);
+                  game.setDecisionProvider(0, BotStrategies::create("smithy"));
+                  game.setDecisionProvider(1, BotStrategies::create("bigmoney"));
+                  game.runHeadless(100);
+                  keep(game.getTurnCount());
+              });
+    }
+
+    // Même partie, relancée dans un seul objet par Game::reset : capacité des zones réutilisée
+    //  同样的对局, 通过 Game::reset 在同一个对象中重新开始: 复用各区域的容量
+    {
+        std::uint64_t seed = 1;
+        const std::vector<std::string> names = {"A", "B"};
+        const std::vector<std::string> kingdom = Game::getFixedKingdomSet("beginner");
+        Game game(names, kingdom, seed);
+        game.setVerbose(false);
+        game.setDecisionProvider(0, BotStrategies::create("smithy"));
+        game.setDecisionProvider(1, BotStrategies::create("bigmoney"));
+        bench("Partie complète (Game::reset)", [&]()
+              {
+                  game.reset(seed++, kingdom, names);
+                  game.runHeadless(100);
+                  keep(game.getTurnCount());
+              });
+    }
+
+    return 0;
+}
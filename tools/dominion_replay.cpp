@@ -0,0 +1,180 @@
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Game.h"
+#include "BotStrategies.h"
+#include "Replay.h"
+#include "Utils.h"
+#include "Random.h"
+
+// Enregistrement et vérification de rejeux (graine + décisions)
+//  回放(种子 + 决策)的记录和验证
+//
+// dominion-replay record rejeux --kingdom advanced --players witch,engine --games 1000
+// dominion-replay rejeux                       (rejoue chaque .dsr et compare l'empreinte finale)
+
+void printUsage()
+{
+    std::cout << "Utilisation:\n"
+              << "  dominion-replay record <dossier> [options]   enregistrer des parties entre bots\n"
+              << "    --kingdom <beginner|advanced|Carte1,Carte2,...>  cartes du royaume (défaut: beginner)\n"
+              << "    --players <strat1,strat2,...>                  stratégies des joueurs (défaut: bigmoney,bigmoney)\n"
+              << "    --games <N>                                    nombre de parties (défaut: 1)\n"
+              << "    --max-turns <N>                                limite de tours par partie (défaut: 100)\n"
+              << "    --seed <N>                                     graine de la première partie (défaut: aléatoire)\n"
+              << "  dominion-replay <fichier.dsr|dossier>...       rejouer et vérifier l'empreinte de l'état final\n";
+}
+
+// Enregistrer des parties : la partie i utilise la graine seed + i, un fichier par partie
+//  记录对局: 第 i 局使用种子 seed + i, 每局一个文件
+static int record(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        throw std::runtime_error("Dossier de destination manquant"); // 缺少目标文件夹
+    }
+    std::filesystem::path directory = argv[2];
+    std::string kingdom = "beginner";
+    std::string players = "bigmoney,bigmoney";
+    long long games = 1;
+    int maxTurns = 100;
+    std::uint64_t seed = Random::randomSeed();
+
+    for (int i = 3; i < argc; i++)
+    {
+        std::string option = argv[i];
+        if (i + 1 >= argc)
+        {
+            throw std::runtime_error("Valeur manquante pour " + option); // 缺少参数值
+        }
+        std::string value = argv[++i];
+
+        if (option == "--kingdom")
+            kingdom = value;
+        else if (option == "--players")
+            players = value;
+        else if (option == "--games")
+            games = std::stoll(value);
+        else if (option == "--max-turns")
+            maxTurns = std::stoi(value);
+        else if (option == "--seed")
+            seed = std::stoull(value);
+        else
+            throw std::runtime_error("Option inconnue: " + option); // 未知选项
+    }
+
+    std::vector<std::string> kingdomCards = Game::getFixedKingdomSet(kingdom);
+    if (kingdomCards.empty())
+    {
+        kingdomCards = Utils::split(kingdom, ',');
+    }
+    std::vector<std::string> strategies = Utils::split(players, ',');
+    std::vector<std::string> names;
+    for (size_t seat = 0; seat < strategies.size(); seat++)
+    {
+        names.push_back(strategies[seat] + "-" + std::to_string(seat + 1));
+    }
+
+    std::filesystem::create_directories(directory);
+    std::size_t decisions = 0;
+    for (long long i = 0; i < games; i++)
+    {
+        Game game(names, kingdomCards, seed + i);
+        game.setVerbose(false);
+        for (size_t seat = 0; seat < strategies.size(); seat++)
+        {
+            game.setDecisionProvider(seat, BotStrategies::create(strategies[seat]));
+        }
+        game.recordReplay(maxTurns);
+        game.runHeadless(maxTurns);
+
+        Replay replay = game.getReplay();
+        decisions += replay.decisions.size();
+        replay.save((directory / ("partie-" + std::to_string(seed + i) + Replay::EXTENSION)).string());
+    }
+    std::cout << games << " parties enregistrées dans " << directory.string() << " (graines " << seed << " à "
+              << seed + games - 1 << ", " << decisions << " décisions)\n";
+    return 0;
+}
+
+// Rejouer chaque fichier et comparer l'empreinte finale à celle enregistrée
+//  重放每个文件并将最终哈希与记录的哈希比较
+static int verify(int argc, char *argv[])
+{
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++)
+    {
+        std::filesystem::path path = argv[i];
+        if (std::filesystem::is_directory(path))
+        {
+            for (const auto &entry : std::filesystem::directory_iterator(path))
+            {
+                if (entry.path().extension() == Replay::EXTENSION)
+                    files.push_back(entry.path().string());
+            }
+        }
+        else
+        {
+            files.push_back(path.string());
+        }
+    }
+
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    long long failures = 0;
+    for (const auto &file : files)
+    {
+        try
+        {
+            Replay replay = Replay::load(file);
+            std::uint64_t hash = replay.run();
+            if (hash != replay.finalStateHash)
+            {
+                failures++;
+                std::cout << "ÉCHEC " << file << ": empreinte " << std::hex << hash << " au lieu de "
+                          << replay.finalStateHash << std::dec << "\n"; // 失败: 哈希不一致
+            }
+        }
+        catch (const std::exception &e)
+        {
+            failures++;
+            std::cout << "ÉCHEC " << file << ": " << e.what() << "\n"; // 失败
+        }
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::cout << files.size() << " rejeux, " << failures << " échecs, " << std::fixed << std::setprecision(2)
+              << seconds << " s";
+    if (seconds > 0)
+    {
+        std::cout << " (" << static_cast<long long>(files.size() / seconds) << " parties/s)";
+    }
+    std::cout << "\n";
+    return failures == 0 ? 0 : 2;
+}
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        if (argc < 2 || std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h")
+        {
+            printUsage();
+            return argc < 2 ? 1 : 0;
+        }
+        if (std::string(argv[1]) == "record")
+        {
+            return record(argc, argv);
+        }
+        return verify(argc, argv);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Erreur: " << e.what() << "\n"; // 错误
+        printUsage();
+        return 1;
+    }
+}
@@ -0,0 +1,135 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Game.h"
+#include "BotStrategies.h"
+#include "MctsStrategy.h"
+#include "Simulation.h"
+#include "Utils.h"
+#include "Random.h"
+
+// Simulation de parties entre bots en parallèle
+//  并行模拟机器人对局
+//
+// dominion-sim --kingdom beginner --players bigmoney,bigmoney --games 100000 --threads 8
+
+void printUsage()
+{
+    std::cout << "Utilisation: dominion-sim [options]\n"
+              << "  --kingdom <beginner|advanced|Carte1,Carte2,...>  cartes du royaume (défaut: beginner)\n"
+              << "  --players <strat1,strat2,...>                  stratégies des joueurs (défaut: bigmoney,bigmoney)\n"
+              << "  --games <N>                                    nombre de parties (défaut: 1000)\n"
+              << "  --threads <N>                                  threads de travail (défaut: tous les cœurs)\n"
+              << "  --max-turns <N>                                limite de tours par partie (défaut: 100)\n"
+              << "  --seed <N>                                     graine de la série (défaut: aléatoire)\n"
+              << "  --stress                                       test de charge: toutes les parties ouvertes en même temps,\n"
+              << "                                                 comparées à la même partie jouée seule\n"
+              << "  --stats <fichier.csv|fichier.json>             statistiques agrégées: victoire par carte,\n"
+              << "                                                 points par tour, tours d'achat\n"
+              << "Stratégies disponibles:";
+    for (const auto &name : BotStrategies::names())
+    {
+        std::cout << " " << name;
+    }
+    std::cout << "\n"
+              << "  mcts accepte un budget par décision: mcts:1000 (playouts), mcts:50ms (temps), mcts:50ms/4 (threads)\n";
+}
+
+int main(int argc, char *argv[])
+{
+    SimulationConfig config;
+    std::string kingdom = "beginner";
+    std::string players = "bigmoney,bigmoney";
+    std::string statsFile;
+    bool stress = false;
+    config.seed = Random::randomSeed();
+
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string option = argv[i];
+            if (option == "--help" || option == "-h")
+            {
+                printUsage();
+                return 0;
+            }
+            if (option == "--stress")
+            {
+                stress = true;
+                continue;
+            }
+            if (i + 1 >= argc)
+            {
+                throw std::runtime_error("Valeur manquante pour " + option); // 缺少参数值
+            }
+            std::string value = argv[++i];
+
+            if (option == "--kingdom")
+                kingdom = value;
+            else if (option == "--players")
+                players = value;
+            else if (option == "--games")
+            {
+                config.games = std::stoll(value);
+                if (config.games <= 0)
+                    throw std::runtime_error("Nombre de parties invalide: " + value); // 对局数量无效
+            }
+            else if (option == "--threads")
+            {
+                config.threads = std::stoi(value);
+                if (config.threads <= 0)
+                    throw std::runtime_error("Nombre de threads invalide: " + value); // 线程数量无效
+            }
+            else if (option == "--max-turns")
+                config.maxTurns = std::stoi(value);
+            else if (option == "--seed")
+                config.seed = std::stoull(value);
+            else if (option == "--stats")
+                statsFile = value;
+            else
+                throw std::runtime_error("Option inconnue: " + option); // 未知选项
+        }
+
+        // Ensemble prédéfini ou liste de cartes séparées par des virgules
+        //  预设套装或以逗号分隔的卡片列表
+        config.kingdomCards = Game::getFixedKingdomSet(kingdom);
+        if (config.kingdomCards.empty())
+        {
+            config.kingdomCards = Utils::split(kingdom, ',');
+        }
+        config.strategies = Utils::split(players, ',');
+
+        std::cout << "Graine: " << config.seed << "\n"; // 种子
+        if (stress)
+        {
+            StressResult result = Simulation::stress(config);
+            std::cout << result.games << " parties simultanées, " << result.mismatches << " divergences, "
+                      << result.forkMismatches << " copies divergentes, " << result.seconds << " s\n"; // 同时进行的对局, 不一致数
+            return result.mismatches == 0 && result.forkMismatches == 0 ? 0 : 2;
+        }
+        SimulationResult result = Simulation::run(config);
+        Simulation::printReport(result);
+        if (!statsFile.empty())
+        {
+            result.statistics.save(statsFile);
+            std::cout << "Statistiques écrites dans " << statsFile << "\n"; // 统计信息已写入文件
+        }
+
+        // Débit des recherches MCTS, pour régler le budget selon la machine
+        //  MCTS 搜索的吞吐量, 用于根据机器调整预算
+        MctsStats mcts = MctsStrategy::totalStats();
+        if (mcts.playouts > 0)
+        {
+            std::cout << "MCTS: " << mcts.decisions << " décisions, " << mcts.playouts << " playouts, "
+                      << static_cast<long long>(mcts.playoutsPerSecond()) << " playouts/s\n";
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Erreur: " << e.what() << "\n"; // 错误
+        printUsage();
+        return 1;
+    }
+    return 0;
+}